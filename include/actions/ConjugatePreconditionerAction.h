@@ -0,0 +1,38 @@
+#ifndef CONJUGATEPRECONDITIONERACTION_H
+#define CONJUGATEPRECONDITIONERACTION_H
+
+#include "Action.h"
+
+class ConjugatePreconditionerAction;
+
+template <>
+InputParameters validParams<ConjugatePreconditionerAction>();
+
+/**
+ * Sets up a field split preconditioner for a conjugate fluid/solid problem
+ * in place of a hand-written [Preconditioning] FSP block.
+ *
+ * Nonlinear variables that live only on the blocks of the fluid density are
+ * put in the fluid split; all others (the solid temperature) in the solid
+ * split.  By default the solid, a symmetric diffusion operator, gets
+ * algebraic multigrid, the fluid gets additive Schwarz with ILU on each
+ * subdomain, and the two are coupled multiplicatively so the fluid solve
+ * sees the updated solid temperature through the interface.
+ */
+class ConjugatePreconditionerAction : public Action
+{
+public:
+  ConjugatePreconditionerAction(InputParameters params);
+
+  virtual void act() override;
+
+protected:
+  /// Add one split of the decomposition.
+  void addSplit(const std::string & name,
+                const std::vector<NonlinearVariableName> & vars,
+                const std::vector<std::string> & splitting,
+                const std::vector<std::string> & petsc_options_iname,
+                const std::vector<std::string> & petsc_options_value);
+};
+
+#endif // CONJUGATEPRECONDITIONERACTION_H
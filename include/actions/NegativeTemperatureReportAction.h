@@ -0,0 +1,25 @@
+#ifndef NEGATIVETEMPERATUREREPORTACTION_H
+#define NEGATIVETEMPERATUREREPORTACTION_H
+
+#include "Action.h"
+
+class NegativeTemperatureReportAction;
+
+template <>
+InputParameters validParams<NegativeTemperatureReportAction>();
+
+/**
+ * Adds a NegativeTemperatureCount on EXEC_FINAL for every ThermalMaterial,
+ * so that the negative temperatures of the last step are still reported.
+ * The materials report the earlier steps themselves at the start of the
+ * next one, which a Steady solve never reaches.  Built without input.
+ */
+class NegativeTemperatureReportAction : public Action
+{
+public:
+  NegativeTemperatureReportAction(InputParameters params);
+
+  virtual void act() override;
+};
+
+#endif // NEGATIVETEMPERATUREREPORTACTION_H
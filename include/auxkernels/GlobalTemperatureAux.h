@@ -2,6 +2,7 @@
 #define GLOBALTEMPERATUREAUX_H
 
 #include "NSTemperatureAux.h"
+#include "PhaseTimer.h"
 
 class GlobalTemperatureAux;
 
@@ -13,10 +14,15 @@ class GlobalTemperatureAux : public NSTemperatureAux
 public:
   GlobalTemperatureAux(const InputParameters & parameters);
 
+  virtual void compute() override;
+
 protected:
   virtual Real computeValue();
 
   const VariableValue & _solid_temperature;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters & _object_counters;
 };
 
 #endif // GLOBALTEMPERATUREAUX_H
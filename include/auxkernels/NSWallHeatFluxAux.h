@@ -0,0 +1,44 @@
+#ifndef NSWALLHEATFLUXAUX_H
+#define NSWALLHEATFLUXAUX_H
+
+#include "AuxKernel.h"
+#include "IdealGasFluidProperties.h"
+#include "PhaseTimer.h"
+
+class NSWallHeatFluxAux;
+
+template <>
+InputParameters validParams<NSWallHeatFluxAux>();
+
+/**
+ * The conductive heat flux from an NS fluid into a no-slip wall,
+ * -k grad(T) . n, with the temperature gradient taken from rho and rhoE as
+ * in NSThermalFluxInterface.  It is averaged over each side of the boundary,
+ * so the variable must be CONSTANT MONOMIAL.  Used to hand the wall heat
+ * flux to a separately solved solid (see ConjugateHeatFluxBC).
+ */
+class NSWallHeatFluxAux : public AuxKernel
+{
+public:
+  NSWallHeatFluxAux(const InputParameters & parameters);
+
+  virtual void compute() override;
+
+protected:
+  virtual Real computeValue();
+
+  const VariableValue & _rho;
+  const VariableGradient & _grad_rho;
+  const VariableValue & _rhoE;
+  const VariableGradient & _grad_rhoE;
+
+  const IdealGasFluidProperties & _fp;
+  const MaterialProperty<Real> & _kappa;
+
+  const MooseArray<Point> & _normals;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters & _object_counters;
+};
+
+#endif // NSWALLHEATFLUXAUX_H
@@ -0,0 +1,48 @@
+#ifndef CONJUGATEHEATFLUXBC_H
+#define CONJUGATEHEATFLUXBC_H
+
+#include "DerivativeMaterialInterface.h"
+#include "IntegratedBC.h"
+#include "PhaseTimer.h"
+
+class ConjugateHeatFluxBC;
+
+template<> InputParameters validParams<ConjugateHeatFluxBC>();
+
+/**
+ * The solid side of NSThermalFluxInterface for a solid solved apart from the
+ * fluid: the heat flux from the fluid, computed by the fluid app with
+ * NSWallHeatFluxAux and transferred in as heat_flux, plus the external heat
+ * flux and the surface radiation that the interface kernel applies to the
+ * solid.  The fluid side of the coupling is an NSThermalMatchBC matching the
+ * transferred wall temperature.
+ */
+class ConjugateHeatFluxBC : public DerivativeMaterialInterface<IntegratedBC>
+{
+public:
+  ConjugateHeatFluxBC(const InputParameters & parameters);
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeJacobianBlock(unsigned int jvar) override;
+
+protected:
+  virtual Real computeQpResidual();
+  virtual Real computeQpJacobian();
+
+  const VariableValue & _heat_flux;
+  Function * _heat_flux_func;
+
+  const MaterialProperty<Real> & _epsilon;
+  const MaterialProperty<Real> & _d_epsilon_dT;
+  const Real _stefan_boltzmann;
+  const PostprocessorValue & _rad_T;
+
+  /// heat_flux_func along the normal at each qp of the current side.
+  std::vector<Real> _func_flux;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters & _object_counters;
+};
+
+#endif // CONJUGATEHEATFLUXBC_H
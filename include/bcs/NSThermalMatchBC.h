@@ -3,6 +3,7 @@
 
 #include "MatchedValueBC.h"
 #include "IdealGasFluidProperties.h"
+#include "PhaseTimer.h"
 
 class NSThermalMatchBC;
 
@@ -14,6 +15,10 @@ class NSThermalMatchBC : public MatchedValueBC
 public:
   NSThermalMatchBC(const InputParameters & parameters);
 
+  virtual void computeResidual(NumericVector<Number> & residual) override;
+  virtual void computeJacobian() override;
+  virtual void computeOffDiagJacobian(unsigned int jvar) override;
+
 protected:
   virtual Real computeQpResidual() override;
   virtual Real computeQpOffDiagJacobian(unsigned int jvar) override;
@@ -31,6 +36,9 @@ protected:
   const VariableValue & _rhow;
 
   const IdealGasFluidProperties & _fp;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters & _object_counters;
 };
 
 #endif //NSTHERMALMATCHBC_H
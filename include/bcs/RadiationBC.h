@@ -1,24 +1,44 @@
 #ifndef RADIATIONBC_H
 #define RADIATIONBC_H
 
+#include "DerivativeMaterialInterface.h"
 #include "IntegratedBC.h"
+#include "PhaseTimer.h"
 
 class RadiationBC;
+class SurfaceRadiationExchange;
 
 template<> InputParameters validParams<RadiationBC>();
 
-class RadiationBC : public IntegratedBC
+class RadiationBC : public DerivativeMaterialInterface<IntegratedBC>
 {
 public:
   RadiationBC(const InputParameters & parameters);
 
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeJacobianBlock(unsigned int jvar) override;
+
 protected:
+  /// Update _env_emission for the current side.
+  void updateEnvironment();
+
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
 
   const MaterialProperty<Real> & _epsilon;
+  const MaterialProperty<Real> & _d_epsilon_dT;
   const Real _stefan_boltzmann;
   const Real & _env_T;
+
+  /// Surface-to-surface exchange supplying the irradiation, if any.
+  const SurfaceRadiationExchange * const _exchange;
+
+  /// sigma T_env^4, or the irradiation of the current side with _exchange.
+  Real _env_emission;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters & _object_counters;
 };
 
 #endif // RADIATIONBC_H
@@ -0,0 +1,58 @@
+#ifndef STEADYSWEEP_H
+#define STEADYSWEEP_H
+
+#include "Steady.h"
+#include "ControllableParameter.h"
+
+#include <fstream>
+
+class SteadySweep;
+
+template <>
+InputParameters validParams<SteadySweep>();
+
+/**
+ * Solves a steady problem once per row of a sweep file, within one run.
+ *
+ * The first row of sweep_file names controllable Real parameters (e.g.
+ * BCs/hot_side/value or Functions/paint_k/value); every following row is
+ * one sweep point and gives a value for each.  The mesh, the systems and
+ * the matrix sparsity are set up once, and each point starts from the
+ * solution of the last converged one unless warm_start = false.  A point
+ * that does not converge is recorded and the sweep goes on from the last
+ * good solution.
+ *
+ * Rank 0 appends one row per point to <file_base>_sweep.csv: the point, its
+ * parameter values, the summary_postprocessors, the nonlinear iterations
+ * and whether it converged.  Outputs see each point as its own time step.
+ */
+class SteadySweep : public Steady
+{
+public:
+  SteadySweep(const InputParameters & parameters);
+
+  virtual void init() override;
+  virtual void execute() override;
+
+protected:
+  void readSweepFile(const std::string & file);
+  void setPoint(unsigned int point);
+  void writeSummaryRow(unsigned int point, bool converged);
+
+  const std::vector<PostprocessorName> & _summary_postprocessor_names;
+  const bool _warm_start;
+
+  /// Parameter names from the header of the sweep file, and each row.
+  std::vector<std::string> _parameter_names;
+  std::vector<std::vector<Real>> _points;
+
+  std::vector<ControllableParameter<Real>> _parameters;
+  std::vector<const PostprocessorValue *> _summary_postprocessors;
+
+  /// The solution each point starts from.
+  std::unique_ptr<NumericVector<Number>> _start_solution;
+
+  std::ofstream _summary;
+};
+
+#endif // STEADYSWEEP_H
@@ -0,0 +1,32 @@
+#ifndef PROJECTEDSOLUTIONIC_H
+#define PROJECTEDSOLUTIONIC_H
+
+#include "InitialCondition.h"
+
+class ProjectedSolutionIC;
+class SolutionProjection;
+
+template <>
+InputParameters validParams<ProjectedSolutionIC>();
+
+/**
+ * Starts a variable from a solution on another mesh, read by a
+ * SolutionProjection.  Each point takes its value from the source block
+ * matching the block of the element it is evaluated on.
+ */
+class ProjectedSolutionIC : public InitialCondition
+{
+public:
+  ProjectedSolutionIC(const InputParameters & parameters);
+
+  virtual Real value(const Point & p) override;
+
+protected:
+  const SolutionProjection & _projection;
+  const std::string _from_variable;
+
+  /// Index of _from_variable in _projection, looked up once it has been read.
+  int _index;
+};
+
+#endif // PROJECTEDSOLUTIONIC_H
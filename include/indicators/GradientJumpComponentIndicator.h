@@ -0,0 +1,27 @@
+#ifndef GRADIENTJUMPCOMPONENTINDICATOR_H
+#define GRADIENTJUMPCOMPONENTINDICATOR_H
+
+#include "InternalSideIndicator.h"
+
+class GradientJumpComponentIndicator;
+
+template <> InputParameters validParams<GradientJumpComponentIndicator>();
+
+/**
+ * The error of one variable of a MultiVarGradientJumpIndicator, which fills
+ * this indicator's field during its own side loop.  Nothing is computed
+ * here; being an indicator only gets the field zeroed before each pass and
+ * finalized like any other internal side indicator.
+ */
+class GradientJumpComponentIndicator : public InternalSideIndicator
+{
+public:
+  GradientJumpComponentIndicator(const InputParameters & parameters);
+
+  virtual void computeIndicator() override {}
+
+protected:
+  virtual Real computeQpIntegral() override { return 0.; }
+};
+
+#endif /* GRADIENTJUMPCOMPONENTINDICATOR_H */
@@ -0,0 +1,51 @@
+#ifndef MULTIVARGRADIENTJUMPINDICATOR_H
+#define MULTIVARGRADIENTJUMPINDICATOR_H
+
+#include "InternalSideIndicator.h"
+#include "PhaseTimer.h"
+
+class MultiVarGradientJumpIndicator;
+
+template <> InputParameters validParams<MultiVarGradientJumpIndicator>();
+
+/**
+ * The gradient jump indicator of several variables computed in one pass over
+ * the internal sides.  Each variable only contributes on sides where it is
+ * active on both elements, as in VarRestrictedGradientJumpIndicator, but the
+ * check is made once per side rather than per quadrature point.
+ *
+ * The indicator itself holds the combined error of all variables, each
+ * weighted by its scaling factor.  The unscaled error of each variable can
+ * also be written to a GradientJumpComponentIndicator, so that separate
+ * markers can still be driven by each variable.
+ */
+class MultiVarGradientJumpIndicator : public InternalSideIndicator
+{
+public:
+  MultiVarGradientJumpIndicator(const InputParameters & parameters);
+
+  virtual void computeIndicator() override;
+
+protected:
+  /// The variables, starting with "variable".
+  std::vector<MooseVariable *> _vars;
+
+  /// The squared scaling factor of each variable.
+  std::vector<Real> _scaling_squared;
+
+  /// Gradients on either side of the current side, for each variable.
+  std::vector<const VariableGradient *> _grad;
+  std::vector<const VariableGradient *> _grad_neighbor;
+
+  /// Fields of the per-variable component indicators, empty if not requested.
+  std::vector<MooseVariable *> _component_fields;
+
+  /// Scratch for the current side.
+  std::vector<unsigned int> _active;
+  std::vector<Real> _sums;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters & _object_counters;
+};
+
+#endif /* MULTIVARGRADIENTJUMPINDICATOR_H */
@@ -2,6 +2,7 @@
 #define VARRESTRICTEDGRADIENTJUMPINDICATOR_H
 
 #include "InternalSideIndicator.h"
+#include "PhaseTimer.h"
 
 class VarRestrictedGradientJumpIndicator;
 
@@ -12,8 +13,13 @@ class VarRestrictedGradientJumpIndicator : public InternalSideIndicator
 public:
   VarRestrictedGradientJumpIndicator(const InputParameters & parameters);
 
+  virtual void computeIndicator() override;
+
 protected:
   virtual Real computeQpIntegral() override;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters & _object_counters;
 };
 
 #endif /* VARRESTRICTEDGRADIENTJUMPINDICATOR_H */
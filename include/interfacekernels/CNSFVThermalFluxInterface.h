@@ -3,8 +3,6 @@
 
 #include "InterfaceKernel.h"
 #include "CNSFVThermalBCUserObject.h"
-#include "InternalSideFluxBase.h"
-#include "SlopeLimitingBase.h"
 #include "SinglePhaseFluidProperties.h"
 
 //Forward Declarations
@@ -13,22 +11,33 @@ class CNSFVThermalFluxInterface;
 template<>
 InputParameters validParams<CNSFVThermalFluxInterface>();
 
+/**
+ * Couples a cell-centered finite volume (CNSFV) fluid to a finite element
+ * solid temperature across a wall.  One instance is added per fluid
+ * equation.  Each applies the impermeable-wall flux of
+ * CNSFVThermalBCUserObject; the total-energy instance also exchanges heat
+ * with the solid through the fluid half cell,
+ *   q = k_f / d * (T_s - T_f),
+ * where d is the distance from the fluid cell centroid to the wall.
+ * The fluid is assumed to be in the primary domain.
+ */
 class CNSFVThermalFluxInterface : public InterfaceKernel
 {
 public:
   CNSFVThermalFluxInterface(const InputParameters & parameters);
 
 protected:
-  virtual void computeElemNeighResidual(Moose::DGResidualType type);
   virtual Real computeQpResidual(Moose::DGResidualType type);
   virtual Real computeQpJacobian(Moose::DGJacobianType type);
   virtual Real computeQpOffDiagJacobian(Moose::DGJacobianType type, unsigned int jvar);
 
+  /// Fill _uvec_cell, _T_fluid, _conductance and _dT_du for the current qp.
+  void computeQpHeatTransfer();
+
   /// choose an equation
   MooseEnum _component;
 
   // "1" denotes the "left" state
-  // "2" denotes the "right" state
 
   // piecewise constant variable values in cells
   const VariableValue & _rhoc1;
@@ -44,12 +53,7 @@ protected:
   const MaterialProperty<Real> & _rhow1;
   const MaterialProperty<Real> & _rhoe1;
 
-  // material properties for gradient matching
-  const MaterialProperty<Real> & _k_neighbor;
-
   const CNSFVThermalBCUserObject & _bc_uo;
-  const InternalSideFluxBase & _flux;
-  const SlopeLimitingBase & _slope;
 
   unsigned int _rho_var;
   unsigned int _rhou_var;
@@ -59,7 +63,15 @@ protected:
 
   const SinglePhaseFluidProperties & _fp;
 
+  /// Maps the coupled fluid variable numbers to their position in the state vector.
   std::map<unsigned int, unsigned int> _jmap;
+
+  // Scratch for the current qp.
+  std::vector<Real> _uvec_face;
+  std::vector<Real> _uvec_cell;
+  std::vector<Real> _dT_du;
+  Real _T_fluid;
+  Real _conductance;
 };
 
 #endif // CNSFVTHERMALFLUXINTERFACE_H
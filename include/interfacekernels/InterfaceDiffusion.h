@@ -16,6 +16,7 @@
 #define INTERFACEDIFFUSION_H
 
 #include "InterfaceKernel.h"
+#include "PhaseTimer.h"
 
 // Forward Declarations
 class InterfaceDiffusion;
@@ -31,12 +32,20 @@ class InterfaceDiffusion : public InterfaceKernel
 public:
   InterfaceDiffusion(const InputParameters & parameters);
 
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeElementOffDiagJacobian(unsigned int jvar) override;
+  virtual void computeNeighborOffDiagJacobian(unsigned int jvar) override;
+
 protected:
   virtual Real computeQpResidual(Moose::DGResidualType type);
   virtual Real computeQpJacobian(Moose::DGJacobianType type);
 
   Real _D;
   Real _D_neighbor;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters & _object_counters;
 };
 
 #endif
@@ -2,28 +2,62 @@
 #define NSTHERMALFLUXINTERFACE_H
 
 #include "InterfaceKernel.h"
+#include "InterfaceHeatFluxSampler.h"
 #include "IdealGasFluidProperties.h"
 #include "DerivativeMaterialInterface.h"
 #include "MooseParsedVectorFunction.h"
 #include "PostprocessorInterface.h"
+#include "PhaseTimer.h"
 
 //Forward Declarations
 class NSThermalFluxInterface;
+class SurfaceRadiationExchange;
 
 template<> InputParameters validParams<NSThermalFluxInterface>();
 
-class NSThermalFluxInterface : public InterfaceKernel,
+class NSThermalFluxInterface : public DerivativeMaterialInterface<InterfaceKernel>,
                                public PostprocessorInterface
 {
 public:
   NSThermalFluxInterface(const InputParameters & parameters);
 
+  virtual void initialSetup() override;
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeElementOffDiagJacobian(unsigned int jvar) override;
+  virtual void computeNeighborOffDiagJacobian(unsigned int jvar) override;
+
 protected:
-  // virtual void computeElemNeighResidual(Moose::DGResidualType type);
+  virtual void computeElemNeighResidual(Moose::DGResidualType type) override;
+  virtual void computeElemNeighJacobian(Moose::DGJacobianType type) override;
   virtual Real computeQpResidual(Moose::DGResidualType type);
   virtual Real computeQpJacobian(Moose::DGJacobianType type);
+  virtual Real computeQpOffDiagJacobian(Moose::DGJacobianType type, unsigned int jvar);
+
+  /// Evaluate the per-qp heat fluxes of the current side into the scratch arrays.
+  void computeSideFluxes(bool residual);
+
+  /// Update _rad_T4 for the current side.
+  void updateRadiationField();
+
+  /**
+   * Evaluate the external heat flux functions once per qp of the current
+   * side, rather than once per residual type (and test function).
+   */
+  void updateFunctionFluxes();
+
+  /// Record the flux terms of the current side for the heat flux sampler.
+  void recordSamples();
+
+  /**
+   * The derivative of the neighbor property name with respect to the solid
+   * temperature, or zero if no material declares it (e.g. a
+   * GenericConstantMaterial solid).
+   */
+  const MaterialProperty<Real> & getNeighborPropertyDerivative(const std::string & name);
 
 private:
+  unsigned int _rho_var;
   const VariableValue & _rho;
   const VariableGradient & _grad_rho;
   const IdealGasFluidProperties & _fp;
@@ -33,12 +67,56 @@ private:
   const MaterialProperty<Real> & _kappa_neighbor; // thermal conductivity
   const MaterialProperty<Real> & _epsilon_neighbor;
 
+  // Derivatives with respect to the solid temperature, only used on the solid side.
+  const MaterialProperty<Real> & _d_kappa_dT;
+  const MaterialProperty<Real> & _d_epsilon_dT;
+  const MaterialProperty<Real> & _d_kappa_dT_neighbor;
+  const MaterialProperty<Real> & _d_epsilon_dT_neighbor;
+
   Function & _var_flux_func;
   Function & _neighbor_flux_func;
 
   const Real _stefan_boltzmann;
   const PostprocessorValue & _rad_T;
 
+  /// Surface-to-surface exchange supplying the irradiation, if any.
+  const SurfaceRadiationExchange * const _exchange;
+
+  /// The radiation field the solid sees on the current side, as T^4.
+  Real _rad_T4;
+
+  /// Assemble whole blocks from per-side arrays instead of calling the Qp methods.
+  const bool _batched;
+
+  /// This thread's buffer of the InterfaceHeatFluxSampler, if any.
+  InterfaceHeatFluxSampler::SideSamples * const _samples;
+  unsigned int _sampler_stride;
+
+  /// Whether the fluid (_var) lives on the current element of this side.
+  bool _fluid_on_element;
+
+  // Per-qp scratch arrays for the current side.
+  std::vector<Real> _average_flux;
+  std::vector<Real> _element_external_flux;
+  std::vector<Real> _neighbor_external_flux;
+  std::vector<Real> _inv_rho_cv;
+  std::vector<Real> _grad_rho_normal_over_rho;
+  std::vector<Real> _radiation_jacobian;
+  std::vector<Real> _solid_conduction_jacobian;
+  std::vector<Real> _qp_weight;
+  std::vector<Real> _fluid_conduction;
+  std::vector<Real> _solid_conduction;
+  std::vector<Real> _radiation_flux;
+
+  /// The external heat fluxes of the functions along the normal, per qp.
+  std::vector<Real> _var_func_flux;
+  std::vector<Real> _neighbor_func_flux;
+
+  /// Per-(j, qp) flux derivatives for one Jacobian block, indexed [j * n_qp + qp].
+  std::vector<Real> _block_terms;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters & _object_counters;
 };
 
 #endif // NSTHERMALFLUXINTERFACE_H
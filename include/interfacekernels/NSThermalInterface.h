@@ -4,6 +4,7 @@
 #include "InterfaceKernel.h"
 #include "IdealGasFluidProperties.h"
 #include "DerivativeMaterialInterface.h"
+#include "PhaseTimer.h"
 
 //Forward Declarations
 class NSThermalInterface;
@@ -19,12 +20,19 @@ class NSThermalInterface : public InterfaceKernel
 public:
   NSThermalInterface(const InputParameters & parameters);
 
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeElementOffDiagJacobian(unsigned int jvar) override;
+  virtual void computeNeighborOffDiagJacobian(unsigned int jvar) override;
+
 protected:
   // virtual void computeElemNeighResidual(Moose::DGResidualType type);
   virtual Real computeQpResidual(Moose::DGResidualType type);
   virtual Real computeQpJacobian(Moose::DGJacobianType type);
+  virtual Real computeQpOffDiagJacobian(Moose::DGJacobianType type, unsigned int jvar);
 
 private:
+  unsigned int _rho_var;
   const VariableValue & _rho;
   const VariableGradient & _grad_rho;
   const IdealGasFluidProperties & _fp;
@@ -33,6 +41,9 @@ private:
   const MaterialProperty<Real> & _kappa_neighbor; // thermal conductivity
   const MaterialProperty<Real> & _rho_neighbor;
   const MaterialProperty<Real> & _specific_heat_neighbor;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters & _object_counters;
 };
 
 #endif // NSTHERMALINTERFACE_H
@@ -2,23 +2,46 @@
 #define RESISTIVETHERMALINTERFACE_H
 
 #include "InterfaceKernel.h"
+#include "PhaseTimer.h"
+#include "PiecewisePolynomial.h"
 
 //Forward Declarations
 class ResistiveThermalInterface;
 
 template<> InputParameters validParams<ResistiveThermalInterface>();
 
+/**
+ * A thin layer (e.g. a coating or paint) between two blocks, modelled as a
+ * zero-thickness thermal resistance instead of being meshed.  The heat flux
+ * across the interface is
+ *   q = k_l(T_m) / t(T_m) * (T - T_neighbor),
+ * where the layer conductivity k_l and thickness t are evaluated at the mean
+ * interface temperature T_m.  The temperature on either side is a separate
+ * variable, so the jump across the layer is resolved.
+ */
 class ResistiveThermalInterface : public InterfaceKernel
 {
 public:
   ResistiveThermalInterface(const InputParameters & parameters);
 
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+  virtual void computeElementOffDiagJacobian(unsigned int jvar) override;
+  virtual void computeNeighborOffDiagJacobian(unsigned int jvar) override;
+
 protected:
   virtual Real computeQpResidual(Moose::DGResidualType type);
   virtual Real computeQpJacobian(Moose::DGJacobianType type);
 
-  const MaterialProperty<Real> & _k;
-  const MaterialProperty<Real> & _k_neighbor;
+  /// The layer conductance k_l / t and its derivative at the current qp.
+  void computeQpConductance(Real & h, Real & dh_dTm) const;
+
+  /// Layer conductivity and thickness as functions of temperature.
+  PiecewisePolynomial _k_layer;
+  PiecewisePolynomial _thickness;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters & _object_counters;
 };
 
 #endif  // RESISTIVETHERMALINTERFACE_H
@@ -3,6 +3,7 @@
 
 #include "DerivativeMaterialInterface.h"
 #include "Diffusion.h"
+#include "PhaseTimer.h"
 
 // Forward Declarations
 class HeatConductionKernelDMI;
@@ -14,6 +15,9 @@ class HeatConductionKernelDMI : public DerivativeMaterialInterface<Diffusion> {
 public:
   HeatConductionKernelDMI(const InputParameters &parameters);
 
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+
 protected:
   virtual Real computeQpResidual();
   virtual Real computeQpJacobian();
@@ -21,6 +25,9 @@ protected:
 private:
   const MaterialProperty<Real> &_diffusion_coefficient;
   const MaterialProperty<Real> &_d_diffusion_coefficient_dT;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters &_object_counters;
 };
 
 #endif // HEATCONDUCTIONDMIKERNEL_H
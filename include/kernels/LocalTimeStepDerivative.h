@@ -0,0 +1,46 @@
+#ifndef LOCALTIMESTEPDERIVATIVE_H
+#define LOCALTIMESTEPDERIVATIVE_H
+
+#include "DerivativeMaterialInterface.h"
+#include "PhaseTimer.h"
+#include "TimeKernel.h"
+
+// Forward Declarations
+class LocalTimeStepDerivative;
+
+template <> InputParameters validParams<LocalTimeStepDerivative>();
+
+/**
+ * Turns the physical time derivative of a variable into a pseudo-time
+ * derivative with the element-local step of LocalTimeStepMaterial.  It adds
+ *   rho cp (dt / dtau - 1) du/dt
+ * to the rho cp du/dt already in the equation (the NavierStokes action's
+ * TimeDerivative kernels, or SpecificHeatConductionTimeDerivative with
+ * density and specific_heat given), so that with implicit Euler the sum is
+ * rho cp (u - u_old) / dtau.  The global dt then only labels the steps.
+ * dtau is fixed over the solve, but rho cp may depend on u.
+ */
+class LocalTimeStepDerivative : public DerivativeMaterialInterface<TimeKernel> {
+public:
+  LocalTimeStepDerivative(const InputParameters &parameters);
+
+  virtual void computeResidual() override;
+  virtual void computeJacobian() override;
+
+protected:
+  virtual Real computeQpResidual() override;
+  virtual Real computeQpJacobian() override;
+
+  Real coefficient() const;
+
+  const MaterialProperty<Real> &_density;
+  const MaterialProperty<Real> &_specific_heat;
+  const MaterialProperty<Real> &_d_density_du;
+  const MaterialProperty<Real> &_d_specific_heat_du;
+  const MaterialProperty<Real> &_local_time_step;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters &_object_counters;
+};
+
+#endif // LOCALTIMESTEPDERIVATIVE_H
@@ -1,8 +1,10 @@
 #ifndef INTERFACEERRORFRACTIONMARKER_H
 #define INTERFACEERRORFRACTIONMARKER_H
 
+#include "BoundaryElementBand.h"
 #include "MooseMesh.h"
 #include "ErrorFractionMarker.h"
+#include "PhaseTimer.h"
 
 class InterfaceErrorFractionMarker;
 
@@ -13,11 +15,20 @@ class InterfaceErrorFractionMarker : public ErrorFractionMarker
 public:
   InterfaceErrorFractionMarker(const InputParameters & parameters);
 
+  virtual void markerSetup() override;
+  virtual void meshChanged() override;
+
 protected:
   virtual MarkerValue computeElementMarker() override;
 
   const BoundaryID _bnd_id;
 
+  /// Elements on or near the boundary, shared with the other markers of the same boundary.
+  const std::shared_ptr<BoundaryElementBand> _band;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters & _object_counters;
+
 private:
 	MarkerValue getMaxChildMarker(const Elem *, unsigned int);
   unsigned int getMaxChildLevel(const Elem *);
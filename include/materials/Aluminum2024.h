@@ -12,6 +12,9 @@ class Aluminum2024 : public ThermalMaterial {
 public:
   Aluminum2024(const InputParameters &parameters);
 
+  /// The property fits used by the batched evaluation, shared by all instances.
+  static const ThermalPropertyFits &propertyFits();
+
 protected:
   virtual void computeQpProperties() override;
 };
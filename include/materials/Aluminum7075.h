@@ -12,6 +12,9 @@ class Aluminum7075 : public ThermalMaterial {
 public:
   Aluminum7075(const InputParameters &parameters);
 
+  /// The property fits used by the batched evaluation, shared by all instances.
+  static const ThermalPropertyFits &propertyFits();
+
 protected:
   virtual void computeQpProperties() override;
 };
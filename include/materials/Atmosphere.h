@@ -12,8 +12,15 @@ class Atmosphere : public ThermalMaterial {
 public:
   Atmosphere(const InputParameters &parameters);
 
+  /// The property fits used by the batched evaluation, shared by all instances.
+  static const ThermalPropertyFits &propertyFits();
+
+  /// The viscosity fit used by the batched evaluation.
+  static const PiecewisePolynomial &viscosityFit();
+
 protected:
   virtual void computeQpProperties() override;
+  virtual void computeBatchProperties(unsigned int n) override;
 
   MaterialProperty<Real> &_mu;
   MaterialProperty<Real> &_d_mu_dT;
@@ -0,0 +1,59 @@
+#ifndef LOCALTIMESTEPMATERIAL_H
+#define LOCALTIMESTEPMATERIAL_H
+
+#include "IdealGasFluidProperties.h"
+#include "Material.h"
+#include "PhaseTimer.h"
+
+// Forward Declarations
+class LocalTimeStepMaterial;
+
+template <> InputParameters validParams<LocalTimeStepMaterial>();
+
+/**
+ * The element-local pseudo-time step used by LocalTimeStepDerivative,
+ *   dtau = CFL * tau,
+ * where tau is the largest stable explicit step of the element and CFL is the
+ * global number ramped by SERCFLNumber.  On fluid blocks (fluid_properties
+ * given) tau comes from the acoustic and diffusion numbers,
+ *   1 / tau = (|u| + c) / h + 2 max(nu, alpha) / h^2,
+ * evaluated from the conserved variables at the start of the step so that
+ * dtau is constant over the nonlinear solve.  On solid blocks it is the
+ * diffusion limit h^2 rho cp / (2 k), from the properties at the start of
+ * the step for the same reason.  h is the smallest edge of the element,
+ * so boundary-layer elements take small steps without holding back the rest.
+ */
+class LocalTimeStepMaterial : public Material {
+public:
+  LocalTimeStepMaterial(const InputParameters &parameters);
+
+protected:
+  virtual void computeProperties() override;
+  virtual void computeQpProperties() override;
+
+  Real fluidTimeStep(Real h) const;
+  Real solidTimeStep(Real h) const;
+
+  const bool _fluid;
+
+  const VariableValue &_rho;
+  const VariableValue &_rhou;
+  const VariableValue &_rhov;
+  const VariableValue &_rhow;
+  const VariableValue &_rhoE;
+  const IdealGasFluidProperties *_fp;
+
+  /// Old values, so that the solid step does not change during the solve.
+  const MaterialProperty<Real> *_thermal_conductivity;
+  const MaterialProperty<Real> *_density;
+  const MaterialProperty<Real> *_specific_heat;
+
+  const PostprocessorValue &_cfl;
+
+  MaterialProperty<Real> &_local_time_step;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters &_object_counters;
+};
+
+#endif // LOCALTIMESTEPMATERIAL_H
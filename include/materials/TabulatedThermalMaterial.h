@@ -0,0 +1,32 @@
+#ifndef TABULATEDTHERMALMATERIAL_H
+#define TABULATEDTHERMALMATERIAL_H
+
+#include "ThermalMaterial.h"
+
+// Forward Declarations
+class TabulatedThermalMaterial;
+class ThermalPropertyLibrary;
+
+template <> InputParameters validParams<TabulatedThermalMaterial>();
+
+/**
+ * A ThermalMaterial whose properties are read from a ThermalPropertyLibrary
+ * file instead of being compiled in.
+ */
+class TabulatedThermalMaterial : public ThermalMaterial {
+public:
+  TabulatedThermalMaterial(const InputParameters &parameters);
+
+protected:
+  virtual void computeQpProperties() override;
+  virtual void computeBatchProperties(unsigned int n) override;
+
+  const ThermalPropertyLibrary &_library;
+
+  /// Properties from the file beyond the ThermalMaterial ones.
+  std::vector<const PiecewisePolynomial *> _extra_fits;
+  std::vector<MaterialProperty<Real> *> _extra_properties;
+  std::vector<MaterialProperty<Real> *> _d_extra_properties_dT;
+};
+
+#endif // TABULATEDTHERMALMATERIAL_H
@@ -3,21 +3,100 @@
 
 #include "DerivativeMaterialInterface.h"
 #include "Material.h"
+#include "MeshChangedInterface.h"
+#include "PhaseTimer.h"
+#include "PiecewisePolynomial.h"
+
+#include <unordered_map>
 
 // Forward Declarations
 class ThermalMaterial;
 
 template <> InputParameters validParams<ThermalMaterial>();
 
-class ThermalMaterial : public DerivativeMaterialInterface<Material> {
+/**
+ * Temperature fits of the properties declared by ThermalMaterial.
+ */
+struct ThermalPropertyFits {
+  PiecewisePolynomial thermal_conductivity;
+  PiecewisePolynomial specific_heat;
+  PiecewisePolynomial density;
+  PiecewisePolynomial epsilon;
+};
+
+class ThermalMaterial : public DerivativeMaterialInterface<Material>,
+                        public MeshChangedInterface {
 public:
   ThermalMaterial(const InputParameters &parameters);
 
+  /**
+   * Statistics of one copy of a material, counted in quadrature points.
+   * There is a copy per thread for each of the volume, face and neighbor
+   * evaluations, and each only touches its own counters, so they take no
+   * locks or atomics; they are only summed between loops.
+   */
+  struct Counters {
+    Counters()
+        : cache_hits(0), cache_misses(0), negative_temperatures(0),
+          min_temperature(0.), min_temperature_elem(DofObject::invalid_id) {}
+
+    unsigned long long cache_hits;
+    unsigned long long cache_misses;
+
+    /// Negative temperatures seen since they were last reported.
+    unsigned long long negative_temperatures;
+    Real min_temperature;
+    dof_id_type min_temperature_elem;
+    Point min_temperature_centroid;
+  };
+
+  /**
+   * Every copy on this rank of the ThermalMaterial called material_name: its
+   * volume, face and neighbor copies on each thread.
+   */
+  static std::vector<ThermalMaterial *>
+  copies(FEProblemBase &problem, const std::string &material_name);
+
+  /// Property cache hits and misses since the start of the run, summed over copies.
+  static void cacheTotals(FEProblemBase &problem,
+                          const std::string &material_name, Real &hits,
+                          Real &misses);
+
+  /**
+   * Sum the negative temperatures seen by material_name over its copies and
+   * the ranks since they were last reported, warn once if there were any and
+   * clear them.  Collective.
+   * @return the number of qp evaluations at a negative temperature
+   */
+  static Real reportNegativeTemperatures(FEProblemBase &problem,
+                                         const std::string &material_name,
+                                         const Parallel::Communicator &comm);
+
+  /// Reports the negative temperatures of the previous step.
+  virtual void timestepSetup() override;
+
+  /// Element ids and sides are reused after adaptivity, so the cache is dropped.
+  virtual void meshChanged() override;
+
 protected:
+  virtual void computeProperties() override;
   virtual void computeQpProperties();
+
+  /// The old properties, for the objects that ask for them, start at the initial temperature.
+  virtual void initQpStatefulProperties() override;
+
   virtual void defaultQpProperties();
   virtual void checkQpTemperature();
 
+  /**
+   * Evaluate every property at all n quadrature points of the current element
+   * at once from _fits.  Derived classes with extra properties extend this.
+   */
+  virtual void computeBatchProperties(unsigned int n);
+
+  /// Add a property to those saved and restored by the property cache.
+  void cacheProperty(MaterialProperty<Real> &property);
+
   const VariableValue &_temperature;
 
   MaterialProperty<Real> &_thermal_conductivity;
@@ -31,6 +110,37 @@ protected:
 
   MaterialProperty<Real> &_epsilon;
   MaterialProperty<Real> &_d_epsilon_dT;
+
+  /// Evaluate from _fits over the whole element instead of per qp.
+  const bool _batch_evaluation;
+
+  /// Property fits, set by derived classes that support batched evaluation.
+  const ThermalPropertyFits *_fits;
+
+  const bool _use_cache;
+  const Real _cache_tolerance;
+
+  /// Timing of this object, see PhaseTimer.
+  PhaseTimer::ObjectCounters &_object_counters;
+
+private:
+  struct CacheEntry {
+    std::vector<Real> temperature;
+
+    /// Cached property values, indexed [property * n_qp + qp].
+    std::vector<Real> values;
+  };
+
+  uint64_t cacheKey() const;
+  bool restoreCachedProperties(unsigned int n);
+  void storeCachedProperties(unsigned int n);
+
+  std::vector<MaterialProperty<Real> *> _cached_properties;
+
+  /// Cache of this copy, keyed on element id and side.
+  std::unordered_map<uint64_t, CacheEntry> _cache;
+
+  Counters _counters;
 };
 
 #endif // THERMALMATERIAL_H
@@ -0,0 +1,75 @@
+#ifndef ASYNCCHECKPOINT_H
+#define ASYNCCHECKPOINT_H
+
+#include "FileOutput.h"
+
+#include <cstdint>
+#include <deque>
+#include <thread>
+
+class AsyncCheckpoint;
+class Backup;
+
+template <>
+InputParameters validParams<AsyncCheckpoint>();
+
+/**
+ * Checkpoints that do not stall the solve.
+ *
+ * Each checkpoint is an in-memory backup of the app (the solution vectors
+ * of every system and all restartable data, including the stateful
+ * material properties), the same snapshot MultiApps take between solves.
+ * Each processor writes its own part to <file_base>_async_cp/<step>-<rank>.bkp
+ * from a background thread while the next steps are solved; only the
+ * snapshot itself is taken synchronously.  The next checkpoint (or the end
+ * of the run) waits for the write, then LATEST is pointed at it and all but
+ * the newest num_files checkpoints are removed, so LATEST only ever names a
+ * complete checkpoint.
+ *
+ * With resume = true a run picks up from LATEST at the end of its initial
+ * setup, continuing the run that wrote it exactly.  The files are
+ * distributed per processor, so the resumed run must use the same mesh and
+ * the same number of processors and threads.  The mesh itself is not
+ * checkpointed, so a run cannot be resumed once adaptivity has changed it.
+ */
+class AsyncCheckpoint : public FileOutput
+{
+public:
+  AsyncCheckpoint(const InputParameters & parameters);
+  virtual ~AsyncCheckpoint();
+
+  virtual void initialSetup() override;
+
+  virtual std::string filename() override;
+
+  /// The directory holding the checkpoints.
+  std::string directory() const;
+
+protected:
+  virtual void output(const ExecFlagType & type) override;
+
+  /// The file of step on this processor.
+  std::string checkpointFile(int step) const;
+
+  /// Identifies the local part of the mesh, refinement included.
+  uint64_t meshHash() const;
+
+  /// Wait for the pending write, then publish it in LATEST and prune.  Collective.
+  void finishPendingWrite();
+
+  /// Load the checkpoint named by LATEST.  Collective.
+  void resume();
+
+  const unsigned int _num_files;
+  const bool _resume;
+
+  /// The background write and the step it is writing, if any.
+  std::thread _writer;
+  int _pending_step;
+  bool _pending_ok;
+
+  /// The complete checkpoints on disk, oldest first.
+  std::deque<int> _steps;
+};
+
+#endif // ASYNCCHECKPOINT_H
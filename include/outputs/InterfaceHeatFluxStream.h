@@ -0,0 +1,43 @@
+#ifndef INTERFACEHEATFLUXSTREAM_H
+#define INTERFACEHEATFLUXSTREAM_H
+
+#include "FileOutput.h"
+
+class InterfaceHeatFluxStream;
+
+template <>
+InputParameters validParams<InterfaceHeatFluxStream>();
+
+/**
+ * Appends the rows of an InterfaceHeatFluxSampler to a single time-series
+ * file each step it sampled, instead of writing a CSV file per step.
+ *
+ * The csv format prefixes each row with the time step and time.  The binary
+ * format starts with the magic "PHXIFS01", the column count (uint32) and
+ * each column name (uint32 length, then the characters), followed by one
+ * record per sampled step: the time step (int32), the time (double), the row
+ * count (uint64) and the rows as doubles in row-major order.  A recovered run
+ * appends to the file of the run it recovers.  scripts/read_interface_flux.py
+ * reads either format.
+ */
+class InterfaceHeatFluxStream : public FileOutput
+{
+public:
+  InterfaceHeatFluxStream(const InputParameters & parameters);
+
+  virtual std::string filename() override;
+
+protected:
+  virtual void output(const ExecFlagType & type) override;
+
+  void writeCSV(const std::vector<const VectorPostprocessorValue *> & columns, bool start);
+  void writeBinary(const std::vector<const VectorPostprocessorValue *> & columns, bool start);
+
+  const VectorPostprocessorName _sampler;
+  const bool _binary;
+
+  /// Whether the file has been started (and its header written) yet.
+  bool _started;
+};
+
+#endif // INTERFACEHEATFLUXSTREAM_H
@@ -0,0 +1,33 @@
+#ifndef OBJECTTIMINGTABLE_H
+#define OBJECTTIMINGTABLE_H
+
+#include "FileOutput.h"
+
+class ObjectTimingTable;
+
+template <>
+InputParameters validParams<ObjectTimingTable>();
+
+/**
+ * Writes the PhaseTimer counters of every Phoenix object of its app (not
+ * those of its MultiApps, which need a table of their own) to a CSV table,
+ * one row per object each time it is output (by default at the end of each
+ * time step).  Calls and seconds are cumulative since the start of the run,
+ * summed over threads and ranks; max_rank_seconds is the time on the
+ * slowest rank.  Declaring one turns PhaseTimer on for the whole run.
+ */
+class ObjectTimingTable : public FileOutput
+{
+public:
+  ObjectTimingTable(const InputParameters & parameters);
+
+  virtual std::string filename() override;
+
+protected:
+  virtual void output(const ExecFlagType & type) override;
+
+  /// Whether the file has been started (and its header written) yet.
+  bool _started;
+};
+
+#endif // OBJECTTIMINGTABLE_H
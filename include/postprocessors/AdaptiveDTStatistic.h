@@ -0,0 +1,35 @@
+#ifndef ADAPTIVEDTSTATISTIC_H
+#define ADAPTIVEDTSTATISTIC_H
+
+#include "GeneralPostprocessor.h"
+
+class AdaptiveDTStatistic;
+class SolutionTimeAndPostProcessorAdaptiveDT;
+
+template <>
+InputParameters validParams<AdaptiveDTStatistic>();
+
+/**
+ * Reports the step acceptance and rejection counts of the
+ * SolutionTimeAndPostProcessorAdaptiveDT time stepper, for tuning its
+ * threshold and growth factor.
+ */
+class AdaptiveDTStatistic : public GeneralPostprocessor
+{
+public:
+  AdaptiveDTStatistic(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  const MooseEnum _statistic;
+
+  /// Found on first use, as the time stepper is built after the postprocessors.
+  const SolutionTimeAndPostProcessorAdaptiveDT * _time_stepper;
+
+  Real _value;
+};
+
+#endif // ADAPTIVEDTSTATISTIC_H
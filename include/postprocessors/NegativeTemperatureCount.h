@@ -0,0 +1,34 @@
+#ifndef NEGATIVETEMPERATURECOUNT_H
+#define NEGATIVETEMPERATURECOUNT_H
+
+#include "GeneralPostprocessor.h"
+
+class NegativeTemperatureCount;
+
+template <>
+InputParameters validParams<NegativeTemperatureCount>();
+
+/**
+ * Reports the number of quadrature point evaluations at which a
+ * ThermalMaterial saw a negative temperature since they were last reported,
+ * summed over threads and ranks, and warns once if there were any.  Without
+ * one the material reports at the start of the next step, and
+ * NegativeTemperatureReportAction adds one on EXEC_FINAL for the last step.
+ */
+class NegativeTemperatureCount : public GeneralPostprocessor
+{
+public:
+  NegativeTemperatureCount(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  const std::string _material_name;
+
+  Real _count;
+};
+
+#endif // NEGATIVETEMPERATURECOUNT_H
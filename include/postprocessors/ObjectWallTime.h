@@ -0,0 +1,34 @@
+#ifndef OBJECTWALLTIME_H
+#define OBJECTWALLTIME_H
+
+#include "GeneralPostprocessor.h"
+
+class ObjectWallTime;
+
+template <>
+InputParameters validParams<ObjectWallTime>();
+
+/**
+ * Reports the calls to, or the time spent so far in, one Phoenix object.
+ * Calls and time are summed over threads and ranks; max_rank_time is the
+ * time on the slowest rank.  Declaring one turns PhaseTimer on for the
+ * whole run.
+ */
+class ObjectWallTime : public GeneralPostprocessor
+{
+public:
+  ObjectWallTime(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  const MooseEnum _statistic;
+  const std::string _object_name;
+
+  Real _value;
+};
+
+#endif // OBJECTWALLTIME_H
@@ -0,0 +1,33 @@
+#ifndef PHASEWALLTIME_H
+#define PHASEWALLTIME_H
+
+#include "GeneralPostprocessor.h"
+#include "PhaseTimer.h"
+
+class PhaseWallTime;
+
+template <>
+InputParameters validParams<PhaseWallTime>();
+
+/**
+ * Reports the time spent so far in one solve phase of the Phoenix objects
+ * of its app, summed over threads and taking the slowest rank.  Declaring one turns
+ * PhaseTimer on for the whole run.
+ */
+class PhaseWallTime : public GeneralPostprocessor
+{
+public:
+  PhaseWallTime(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  const PhaseTimer::Phase _phase;
+
+  Real _seconds;
+};
+
+#endif // PHASEWALLTIME_H
@@ -0,0 +1,46 @@
+#ifndef SERCFLNUMBER_H
+#define SERCFLNUMBER_H
+
+#include "GeneralPostprocessor.h"
+
+class SERCFLNumber;
+
+template <>
+InputParameters validParams<SERCFLNumber>();
+
+/**
+ * The global CFL number of pseudo-transient continuation, ramped by switched
+ * evolution relaxation (SER):
+ *   CFL_{n+1} = CFL_n * R_{n-1} / R_n,
+ * so the pseudo-time step grows as the steady residual R falls and shrinks
+ * when it rises.  R is measured by the solution update of the step divided
+ * by the CFL number it was taken with, since with local time stepping
+ * u_n - u_{n-1} ~ CFL_n * tau * R(u_n).  Execute on initial and
+ * timestep_end; the value is read by LocalTimeStepMaterial on the next step.
+ */
+class SERCFLNumber : public GeneralPostprocessor
+{
+public:
+  SERCFLNumber(const InputParameters & parameters);
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  /// The L2 norm of the solution update over the last step.
+  Real updateNorm();
+
+  const Real _cfl_initial;
+  const Real _cfl_min;
+  const Real _cfl_max;
+  const Real _max_growth;
+  const Real _exponent;
+
+  Real _cfl;
+
+  /// Update norm over CFL of the previous step, or 0 before the first one.
+  Real _old_residual;
+};
+
+#endif // SERCFLNUMBER_H
@@ -0,0 +1,34 @@
+#ifndef THERMALMATERIALCACHESTATISTIC_H
+#define THERMALMATERIALCACHESTATISTIC_H
+
+#include "GeneralPostprocessor.h"
+
+class ThermalMaterialCacheStatistic;
+
+template <>
+InputParameters validParams<ThermalMaterialCacheStatistic>();
+
+/**
+ * Reports the property cache hits, misses or hit fraction of a
+ * ThermalMaterial, counted in quadrature points since the start of the run
+ * and summed over threads and ranks.
+ */
+class ThermalMaterialCacheStatistic : public GeneralPostprocessor
+{
+public:
+  ThermalMaterialCacheStatistic(const InputParameters & parameters);
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+  virtual PostprocessorValue getValue() override;
+
+protected:
+  const MooseEnum _statistic;
+  const std::string _material_name;
+
+  Real _hits;
+  Real _misses;
+};
+
+#endif // THERMALMATERIALCACHESTATISTIC_H
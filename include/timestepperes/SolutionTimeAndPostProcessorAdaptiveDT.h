@@ -10,7 +10,12 @@ template <>
 InputParameters validParams<SolutionTimeAndPostProcessorAdaptiveDT>();
 
 /**
- *
+ * SolutionTimeAdaptiveDT that also watches how much a postprocessor changes
+ * over each step.  While the change stays well below threshold, dt grows by
+ * up to growth_factor per step; as it approaches threshold, dt is scaled to
+ * aim for it; and a step that exceeds it is rejected and retried with a
+ * smaller dt.  The postprocessor is evaluated right after each solve, so it
+ * must be executed on "custom".
  */
 class SolutionTimeAndPostProcessorAdaptiveDT : public SolutionTimeAdaptiveDT, public PostprocessorInterface
 {
@@ -21,6 +26,15 @@ public:
   virtual void preSolve() override;
   virtual void step() override;
   virtual void rejectStep() override;
+  virtual bool converged() override;
+
+  /// Steps so far: accepted, rejected for a large postprocessor change, and failed to solve.
+  unsigned int acceptedSteps() const { return _n_accepted; }
+  unsigned int postprocessorRejections() const { return _n_pp_rejections; }
+  unsigned int solveFailures() const { return _n_solve_failures; }
+
+  /// The change over the last step divided by the threshold.
+  Real lastChangeRatio() const { return _change_ratio; }
 
 protected:
   virtual Real computeInitialDT() override;
@@ -29,6 +43,23 @@ protected:
   const PostprocessorValue * _pps_value;
   const Real _threshold;
   Real _old_pp_value;
+
+  /// Measure the change relative to the old value instead of absolutely.
+  const bool _relative;
+  const Real _growth_factor;
+  const bool _reject_steps;
+
+  /// Whether _old_pp_value holds the value at the start of a step yet.
+  bool _have_old_pp_value;
+
+  /// Whether the current step was rejected for its postprocessor change.
+  bool _pp_rejected;
+
+  Real _change_ratio;
+
+  unsigned int _n_accepted;
+  unsigned int _n_pp_rejections;
+  unsigned int _n_solve_failures;
 };
 
 #endif /* SOLUTIONTIMEANDPOSTPROCESSORADAPTIVEDT_H */
@@ -0,0 +1,49 @@
+#ifndef CNSFVTHERMALBCUSEROBJECT_H
+#define CNSFVTHERMALBCUSEROBJECT_H
+
+#include "BoundaryFluxBase.h"
+#include "SinglePhaseFluidProperties.h"
+
+class CNSFVThermalBCUserObject;
+
+template <>
+InputParameters validParams<CNSFVThermalBCUserObject>();
+
+/**
+ * Inviscid flux through a heat-conducting, impermeable wall for the
+ * cell-centered finite volume (CNSFV) Euler equations: only the pressure
+ * acts on the momentum equations.  The conductive heat flux depends on the
+ * solid on the other side and is added by CNSFVThermalFluxInterface, which
+ * also uses the fluid temperature and its derivatives computed here.
+ */
+class CNSFVThermalBCUserObject : public BoundaryFluxBase
+{
+public:
+  CNSFVThermalBCUserObject(const InputParameters & parameters);
+
+  virtual void calcFlux(unsigned int iside,
+                        dof_id_type ielem,
+                        const std::vector<Real> & uvec1,
+                        const RealVectorValue & dwave,
+                        std::vector<Real> & flux) const override;
+
+  virtual void calcJacobian(unsigned int iside,
+                            dof_id_type ielem,
+                            const std::vector<Real> & uvec1,
+                            const RealVectorValue & dwave,
+                            DenseMatrix<Real> & jac1) const override;
+
+  /**
+   * The temperature and thermal conductivity of the conserved state uvec
+   * (rho, rhou, rhov, rhow, rhoe), and the derivatives of the temperature
+   * with respect to each conserved variable.  The temperature is taken to
+   * depend on the specific volume only through the internal energy, which
+   * is exact for an ideal gas.
+   */
+  void temperature(const std::vector<Real> & uvec, Real & T, Real & k, std::vector<Real> & dT_du) const;
+
+protected:
+  const SinglePhaseFluidProperties & _fp;
+};
+
+#endif // CNSFVTHERMALBCUSEROBJECT_H
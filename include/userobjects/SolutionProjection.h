@@ -0,0 +1,83 @@
+#ifndef SOLUTIONPROJECTION_H
+#define SOLUTIONPROJECTION_H
+
+#include "GeneralUserObject.h"
+
+#include <map>
+#include <memory>
+
+class SolutionProjection;
+
+namespace libMesh
+{
+class EquationSystems;
+class MeshBase;
+class MeshFunction;
+template <typename T>
+class NumericVector;
+}
+
+template <>
+InputParameters validParams<SolutionProjection>();
+
+/**
+ * A solution read from an Exodus file on another mesh, for starting a run
+ * on a new mesh from it with ProjectedSolutionIC.
+ *
+ * Each processor reads the whole source mesh and solution once and locates
+ * only the points of its own elements in it, from one point locator per
+ * thread.  The search is block aware: a point of an element in target
+ * block B is only looked for in the source elements of the block with the
+ * same name (or id, if the blocks are unnamed).  Nodes on an interface
+ * between blocks therefore take each block-restricted variable from its own
+ * side, and points of a remeshed boundary that fall just outside the source
+ * mesh are found within search_tolerance.
+ *
+ * Nodal variables are interpolated with the source elements' shape
+ * functions; elemental ones are piecewise constant.
+ *
+ * The source is not distributed: every processor holds it whole, as a
+ * ReplicatedMesh with a serial copy of its solution, plus one MeshFunction
+ * and point locator per thread, for the life of the object.  Its memory on
+ * each processor is therefore that of the whole source mesh, however many
+ * processors the target mesh is split over.
+ */
+class SolutionProjection : public GeneralUserObject
+{
+public:
+  SolutionProjection(const InputParameters & parameters);
+  virtual ~SolutionProjection();
+
+  virtual void initialSetup() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override {}
+  virtual void finalize() override {}
+
+  /// The index of the source variable called name, for value().
+  unsigned int variableIndex(const std::string & name) const;
+
+  /**
+   * The source variable with index variable at p, found in the source block
+   * matching target_block.
+   */
+  Real value(const Point & p, unsigned int variable, SubdomainID target_block, THREAD_ID tid) const;
+
+protected:
+  void readExodus(const std::string & file);
+
+  const std::vector<VariableName> & _variables;
+  const Real _search_tolerance;
+
+  std::unique_ptr<MeshBase> _source_mesh;
+  std::unique_ptr<EquationSystems> _source_es;
+  std::unique_ptr<NumericVector<Number>> _serialized_solution;
+
+  /// One per thread, each with its own point locator.
+  std::vector<std::unique_ptr<MeshFunction>> _mesh_functions;
+
+  /// The source subdomain searched for each target subdomain.
+  std::map<SubdomainID, std::set<subdomain_id_type>> _source_blocks;
+};
+
+#endif // SOLUTIONPROJECTION_H
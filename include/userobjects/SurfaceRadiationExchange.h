@@ -0,0 +1,126 @@
+#ifndef SURFACERADIATIONEXCHANGE_H
+#define SURFACERADIATIONEXCHANGE_H
+
+#include "GeneralUserObject.h"
+#include "RadiationViewFactors.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+class SurfaceRadiationExchange;
+class MooseVariable;
+
+template <>
+InputParameters validParams<SurfaceRadiationExchange>();
+
+/**
+ * Gray diffuse radiation exchange between the faces of a set of 2D
+ * boundaries, with whatever the faces do not see going to an ambient
+ * temperature.
+ *
+ * The view factors (see RadiationViewFactors) are computed once, each
+ * processor computing the rows of the faces it owns, and stored sparsely.
+ * With view_factor_file they are also cached on disk and read back by later
+ * runs (e.g. restarts) on the same boundary faces, on any number of
+ * processors.  Every execution takes the face temperatures from the nodal
+ * values of a LAGRANGE temperature and the face emissivities from the
+ * epsilon material property, averaged over the face quadrature points on
+ * the solid's side, and solves the radiosity system
+ *   J_i = eps_i sigma T_i^4 + (1 - eps_i) G_i,  G_i = sum_j F_ij J_j
+ * by Gauss-Seidel from the previous radiosities.  RadiationBC and
+ * NSThermalFluxInterface then radiate eps (sigma T^4 - G) from each face.
+ *
+ * Every threaded copy shares the same data, so consumers on any thread see
+ * the result of the last execution.
+ */
+class SurfaceRadiationExchange : public GeneralUserObject
+{
+public:
+  SurfaceRadiationExchange(const InputParameters & parameters);
+
+  virtual void initialSetup() override;
+  virtual void meshChanged() override;
+
+  virtual void initialize() override {}
+  virtual void execute() override;
+  virtual void finalize() override {}
+
+  /// The irradiation G (W/m^2) of the face on side of elem, a local face.
+  Real irradiation(const Elem * elem, unsigned int side) const;
+
+  /// Sweeps taken by the last radiosity solve.
+  unsigned int iterations() const { return _data->iterations; }
+
+protected:
+  struct Data
+  {
+    Data() : built(false), iterations(0) {}
+
+    std::mutex mutex;
+    bool built;
+
+    /// Every face, sorted by (element id, side) so the order is the same on any number of processors.
+    std::vector<RadiationViewFactors::Face> faces;
+    std::vector<dof_id_type> face_elems;
+    std::vector<unsigned short> face_sides;
+    std::vector<BoundaryID> face_boundaries;
+
+    /// Faces owned by this processor, and their index from faceKey().
+    std::vector<unsigned int> local_faces;
+    std::unordered_map<uint64_t, unsigned int> face_index;
+
+    /// View factors of the local faces in compressed rows, in local_faces order.
+    std::vector<std::size_t> row_start;
+    std::vector<unsigned int> columns;
+    std::vector<Real> view_factors;
+    std::vector<Real> ambient_view_factor;
+
+    /// Per face: emissivity, sigma T^4, radiosity and irradiation.
+    std::vector<Real> emissivity;
+    std::vector<Real> emission;
+    std::vector<Real> radiosity;
+    std::vector<Real> irradiation;
+
+    unsigned int iterations;
+  };
+
+  /**
+   * The data shared by the copies of the object called name in problem.  A
+   * MultiApp's instances of the same deck have meshes of their own, so each
+   * has its own data.
+   */
+  static std::shared_ptr<Data> sharedData(const FEProblemBase & problem, const std::string & name);
+
+  static uint64_t faceKey(dof_id_type elem_id, unsigned int side)
+  {
+    return (static_cast<uint64_t>(elem_id) << 8) | side;
+  }
+
+  void build();
+  void buildFaces();
+  void computeViewFactors();
+  bool readViewFactors();
+  void writeViewFactors();
+  uint64_t geometryHash() const;
+
+  void computeEmission();
+  void computeEmissivity();
+  void solveRadiosity();
+
+  const std::vector<BoundaryName> & _boundary_names;
+  const MaterialPropertyName _epsilon_name;
+  const PostprocessorValue & _ambient_T;
+  MooseVariable & _temperature;
+  const unsigned int _samples;
+  const Real _view_factor_tolerance;
+  const Real _tolerance;
+  const unsigned int _max_iterations;
+
+  const bool _use_file;
+  const FileName _file;
+
+  std::shared_ptr<Data> _data;
+};
+
+#endif // SURFACERADIATIONEXCHANGE_H
@@ -0,0 +1,66 @@
+#ifndef BOUNDARYELEMENTBAND_H
+#define BOUNDARYELEMENTBAND_H
+
+#include "MooseTypes.h"
+
+#include "libmesh/elem.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+class MooseMesh;
+
+/**
+ * The active elements with a side on a boundary, plus an optional band of
+ * face-neighbor layers around them, stored as a bitmap over element ids.
+ *
+ * Users that name the same mesh, boundary and layer count share one band.
+ * The band is rebuilt lazily by update() after it has been invalidated, so
+ * it costs one pass over the boundary sides per mesh change rather than a
+ * boundary lookup per element side per use.  On a distributed mesh the
+ * layers are exchanged between processors as they grow, so the band is the
+ * same as on a replicated one however the mesh is partitioned.
+ */
+class BoundaryElementBand {
+public:
+  /// Fetch the band shared by every user of (mesh, boundary, layers).
+  static std::shared_ptr<BoundaryElementBand> get(MooseMesh &mesh,
+                                                  BoundaryID boundary,
+                                                  unsigned int layers);
+
+  /// Mark the band out of date, e.g. after the mesh has changed.
+  void invalidate() { _stale = true; }
+
+  /// Rebuild the band if it is out of date.  Not to be called concurrently
+  /// with contains(), and collective on a distributed mesh.
+  void update();
+
+  bool contains(const Elem *elem) const {
+    const dof_id_type id = elem->id();
+    return id < _in_band.size() && _in_band[id];
+  }
+
+protected:
+  BoundaryElementBand(MooseMesh &mesh, BoundaryID boundary,
+                      unsigned int layers);
+
+  /**
+   * Add the elements of layer to the band, first merging the layers of all
+   * processors on a distributed mesh.  On return layer holds only the
+   * elements that were not already in the band.
+   */
+  void addLayer(std::vector<dof_id_type> &layer);
+
+  MooseMesh &_mesh;
+  const BoundaryID _boundary;
+  const unsigned int _layers;
+
+  bool _stale;
+  std::mutex _mutex;
+
+  /// Whether each element id is in the band.
+  std::vector<bool> _in_band;
+};
+
+#endif // BOUNDARYELEMENTBAND_H
@@ -0,0 +1,111 @@
+#ifndef PHASETIMER_H
+#define PHASETIMER_H
+
+#include "MooseEnum.h"
+#include "MooseTypes.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+/**
+ * Wall time spent in the Phoenix objects, accumulated per solve phase and
+ * per object.
+ *
+ * Timing is off until a PhaseWallTime or ObjectWallTime postprocessor or an
+ * ObjectTimingTable output turns it on, so the objects only pay for one
+ * branch per call otherwise.  Each object keeps its own counters on each
+ * thread, so timing takes no locks; they are only summed when reported.
+ *
+ * The counters are kept per application, so that objects of the same name
+ * in a master app and its MultiApps (e.g. the fluid and solid apps of a
+ * subcycled run) are timed and reported apart.  Each app is named by
+ * MooseApp::name().
+ */
+class PhaseTimer {
+public:
+  enum Phase {
+    MATERIAL,
+    KERNEL_RESIDUAL,
+    KERNEL_JACOBIAN,
+    INTERFACE_RESIDUAL,
+    INTERFACE_JACOBIAN,
+    ADAPTIVITY,
+    BOUNDARY_CONDITION,
+    AUX_KERNEL,
+    NUM_PHASES
+  };
+
+  /// Call count and time per phase of one object on one thread.
+  struct ObjectCounters {
+    ObjectCounters() : calls(0) {
+      std::fill(nanoseconds, nanoseconds + NUM_PHASES, 0);
+    }
+
+    unsigned long long calls;
+    long long nanoseconds[NUM_PHASES];
+  };
+
+  /// The phase names, in Phase order.
+  static MooseEnum phaseEnum();
+
+  static void enable() { _enabled = true; }
+  static bool enabled() { return _enabled.load(std::memory_order_relaxed); }
+
+  /// Seconds accumulated in phase by all objects of app on this process.
+  static Real seconds(const std::string &app, Phase phase);
+
+  /**
+   * The counters of the object of app called name on thread tid, created on
+   * first use.  The face and neighbor copies of a material are objects of
+   * their own, called <name>_face and <name>_neighbor, so they have their
+   * own counters.
+   */
+  static ObjectCounters &objectCounters(const std::string &app,
+                                        const std::string &name,
+                                        const std::string &type, THREAD_ID tid);
+
+  /// Names of every object of app with counters, in a rank-independent order.
+  static std::vector<std::string> objectNames(const std::string &app);
+
+  /// The type of the object of app called name.
+  static std::string objectType(const std::string &app, const std::string &name);
+
+  /// Calls and seconds of the object of app called name, summed over threads.
+  static void objectTotals(const std::string &app, const std::string &name,
+                           Real &calls, Real &seconds);
+
+  /// Times its scope when timing is enabled.
+  class Scope {
+  public:
+    Scope(Phase phase, ObjectCounters &counters)
+        : _phase(phase), _counters(counters), _active(enabled()) {
+      if (_active)
+        _start = std::chrono::steady_clock::now();
+    }
+
+    ~Scope() {
+      if (_active)
+        add(_phase, _counters, std::chrono::steady_clock::now() - _start);
+    }
+
+  private:
+    const Phase _phase;
+    ObjectCounters &_counters;
+    const bool _active;
+    std::chrono::steady_clock::time_point _start;
+  };
+
+protected:
+  static void add(Phase phase, ObjectCounters &counters,
+                  std::chrono::steady_clock::duration elapsed) {
+    ++counters.calls;
+    counters.nanoseconds[phase] +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+  }
+
+  static std::atomic<bool> _enabled;
+};
+
+#endif // PHASETIMER_H
@@ -0,0 +1,84 @@
+#ifndef PIECEWISEPOLYNOMIAL_H
+#define PIECEWISEPOLYNOMIAL_H
+
+#include "MooseTypes.h"
+
+#include <vector>
+
+/**
+ * A piecewise polynomial fit of a property in temperature.
+ *
+ * Each interval holds the coefficients of
+ *   p(T) = c_0 + c_1 * T + ... + c_N * T^N + r / T
+ * padded to a fixed stride so that the Horner loops unroll and the batched
+ * evaluation vectorizes.  An interval is valid up to and including its upper
+ * bound, which matches the "<=" convention of the hand-coded fits.  Short
+ * fits select the interval branch-free; long ones (e.g. interpolated tables)
+ * bisect.
+ */
+class PiecewisePolynomial {
+public:
+  /// Highest polynomial degree supported by an interval.
+  static const unsigned int max_degree = 5;
+
+  /// Number of Reals stored per interval: the polynomial plus the 1/T term.
+  static const unsigned int stride = max_degree + 2;
+
+  /// Above this many breakpoints the interval is found by bisection.
+  static const unsigned int linear_search_limit = 8;
+
+  /// An empty fit; intervals must be added before it is evaluated.
+  PiecewisePolynomial();
+
+  /// A fit that is constant everywhere.
+  PiecewisePolynomial(Real constant);
+
+  /**
+   * Linear interpolation of (T, value) points, held constant outside the
+   * table.  T must be strictly increasing.
+   */
+  static PiecewisePolynomial linearInterpolation(const std::vector<Real> &T,
+                                                 const std::vector<Real> &values);
+
+  /**
+   * Append an interval ending at upper_bound.  Intervals must be added in
+   * increasing order; the last one added extends to +infinity.
+   * @param coefficients polynomial coefficients, lowest power first
+   * @param reciprocal coefficient of the 1/T term
+   */
+  void addInterval(Real upper_bound, const std::vector<Real> &coefficients,
+                   Real reciprocal = 0.);
+
+  /// Evaluate the fit and its temperature derivative at a single point.
+  void evaluate(Real T, Real &value, Real &derivative) const;
+
+  /// Evaluate the fit and its temperature derivative at n points.
+  void evaluate(const Real *T, Real *value, Real *derivative,
+                unsigned int n) const;
+
+  Real value(Real T) const;
+  Real derivative(Real T) const;
+
+  /// Upper bounds of all intervals except the last (i.e. the breakpoints).
+  std::vector<Real> breakpoints() const;
+
+  unsigned int numIntervals() const { return _n_intervals; }
+
+protected:
+  template <bool reciprocal, bool bisect>
+  void evaluateBatch(const Real *T, Real *value, Real *derivative,
+                     unsigned int n) const;
+
+  unsigned int _n_intervals;
+
+  /// Upper bounds of each interval; the last entry is never compared against.
+  std::vector<Real> _upper_bounds;
+
+  /// Interval coefficients, stride Reals per interval.
+  std::vector<Real> _coefficients;
+
+  /// Skip the 1/T term entirely when no interval uses it.
+  bool _has_reciprocal;
+};
+
+#endif // PIECEWISEPOLYNOMIAL_H
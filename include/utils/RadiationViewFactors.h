@@ -0,0 +1,81 @@
+#ifndef RADIATIONVIEWFACTORS_H
+#define RADIATIONVIEWFACTORS_H
+
+#include "MooseTypes.h"
+
+#include "libmesh/point.h"
+
+#include <utility>
+#include <vector>
+
+/**
+ * Gray-body view factors between the straight faces of a 2D boundary.
+ *
+ * The unobstructed view factor of a pair of faces is exact from Hottel's
+ * crossed strings; it is then scaled by the fraction of sample rays between
+ * the two faces that no other face blocks.  The blocking tests run against a
+ * bounding volume hierarchy of the faces, so a ray costs O(log N) and a row
+ * O(N log N).  Only pairs whose centroids face each other are considered.
+ */
+class RadiationViewFactors {
+public:
+  /// A boundary face and its unit normal pointing into the transparent medium.
+  struct Face {
+    Point a;
+    Point b;
+    Point normal;
+  };
+
+  /// The nonzero view factors of one face, as (face index, view factor).
+  typedef std::vector<std::pair<unsigned int, Real>> Row;
+
+  /**
+   * @param faces every face that radiates or blocks
+   * @param samples rays cast from each face per face, squared per pair
+   */
+  RadiationViewFactors(const std::vector<Face> &faces, unsigned int samples);
+
+  /// The view factors from face i larger than tolerance.
+  void computeRow(unsigned int i, Real tolerance, Row &row) const;
+
+  /// The view factor from face i to face j ignoring every other face.
+  Real unobstructedViewFactor(unsigned int i, unsigned int j) const;
+
+  /// The fraction of the sample rays between faces i and j that reach.
+  Real visibleFraction(unsigned int i, unsigned int j) const;
+
+  /// Whether a face other than i and j crosses the segment from p to q.
+  bool blocked(const Point &p, const Point &q, unsigned int i,
+               unsigned int j) const;
+
+protected:
+  struct Node {
+    Real min_x, min_y, max_x, max_y;
+
+    /// Children for an interior node; a range of _order for a leaf.
+    unsigned int left, right;
+    unsigned int begin, end;
+    bool leaf;
+  };
+
+  /// Build the node over _order[begin, end) and return its index.
+  unsigned int build(unsigned int begin, unsigned int end);
+
+  /// Partition _order[begin, end) about middle by face centroid along axis.
+  void splitAt(unsigned int begin, unsigned int middle, unsigned int end,
+               unsigned int axis);
+
+  /// The area (plus a little perimeter) of the box of _order[begin, end).
+  Real splitCost(unsigned int begin, unsigned int end) const;
+
+  /// Whether the segment from p to p + d can touch the box of node.
+  bool hits(const Node &node, const Point &p, const Point &d) const;
+
+  const std::vector<Face> _faces;
+  const unsigned int _samples;
+
+  std::vector<unsigned int> _order;
+  std::vector<Node> _nodes;
+};
+
+#endif // RADIATIONVIEWFACTORS_H
@@ -0,0 +1,41 @@
+#ifndef THERMALPROPERTYLIBRARY_H
+#define THERMALPROPERTYLIBRARY_H
+
+#include "ThermalMaterial.h"
+
+#include <map>
+#include <string>
+
+/**
+ * Property fits read from a CSV file.
+ *
+ * Each non-comment line is "property, kind, T, values...", where kind is
+ *   poly  - polynomial coefficients (lowest power first) valid up to T
+ *   recip - a single coefficient r for r / T valid up to T
+ *   point - a single (T, value) sample, linearly interpolated
+ * Polynomial and reciprocal rows for a property must be in increasing order
+ * of T; "inf" closes the last interval.  Properties other than the four
+ * ThermalMaterial ones are kept as extra properties.
+ *
+ * Files are parsed once per process and shared by every thread and block
+ * that names the same file.
+ */
+class ThermalPropertyLibrary {
+public:
+  /// Fetch the library for file, reading it on first use.
+  static const ThermalPropertyLibrary &get(const std::string &file);
+
+  const ThermalPropertyFits &fits() const { return _fits; }
+
+  const std::map<std::string, PiecewisePolynomial> &extraProperties() const {
+    return _extra_properties;
+  }
+
+protected:
+  ThermalPropertyLibrary(const std::string &file);
+
+  ThermalPropertyFits _fits;
+  std::map<std::string, PiecewisePolynomial> _extra_properties;
+};
+
+#endif // THERMALPROPERTYLIBRARY_H
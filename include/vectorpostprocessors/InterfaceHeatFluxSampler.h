@@ -0,0 +1,94 @@
+#ifndef INTERFACEHEATFLUXSAMPLER_H
+#define INTERFACEHEATFLUXSAMPLER_H
+
+#include "GeneralVectorPostprocessor.h"
+
+#include <map>
+#include <memory>
+#include <unordered_map>
+
+class InterfaceHeatFluxSampler;
+
+template <>
+InputParameters validParams<InterfaceHeatFluxSampler>();
+
+/**
+ * The heat flux terms of an NSThermalFluxInterface at every interface
+ * quadrature point, one row per qp, every stride time steps.
+ *
+ * The interface kernel records the terms it assembles into per-thread
+ * buffers during the residual evaluations of a sampling step; the last
+ * evaluation is that of the converged solution.  This collects them at
+ * timestep_end, sorted by (element id, side, qp) on each processor and
+ * gathered to processor 0.  The fluxes are along the normal from the fluid
+ * into the solid:
+ *   fluid_conduction  -k_f grad(T_f) . n
+ *   solid_conduction  -k_s grad(T_s) . n
+ *   fluid_external    -q_fluid . n   (var_heat_flux_func)
+ *   solid_external    -q_solid . n   (neighbor_heat_flux_func)
+ *   radiation         eps (sigma T_s^4 - G), emitted by the solid
+ * Pair it with an InterfaceHeatFluxStream output to append the rows to one
+ * file instead of writing a CSV file per step.
+ */
+class InterfaceHeatFluxSampler : public GeneralVectorPostprocessor
+{
+public:
+  InterfaceHeatFluxSampler(const InputParameters & parameters);
+  virtual ~InterfaceHeatFluxSampler();
+
+  struct Sample
+  {
+    Point point;
+    dof_id_type elem;
+    unsigned short side;
+    unsigned short qp;
+
+    Real fluid_temperature;
+    Real solid_temperature;
+    Real fluid_conduction;
+    Real solid_conduction;
+    Real fluid_external;
+    Real solid_external;
+    Real radiation;
+  };
+
+  /// The samples of one thread, by side (element id << 8 | side).
+  typedef std::unordered_map<uint64_t, std::vector<Sample>> SideSamples;
+
+  /**
+   * The buffer the interface kernels of problem on thread tid record into
+   * for the sampler called name.  Each problem (e.g. each MultiApp instance
+   * of a deck) has its own.
+   */
+  static SideSamples &
+  threadSamples(const SubProblem & problem, const std::string & name, THREAD_ID tid);
+
+  /// The stride of the sampler of problem called name, or 0 if there is none.
+  static unsigned int stride(const SubProblem & problem, const std::string & name);
+
+  /// The names of the vectors, in column order.
+  static const std::vector<std::string> & columnNames();
+
+  virtual void initialize() override;
+  virtual void execute() override;
+  virtual void finalize() override;
+
+protected:
+  struct Shared
+  {
+    Shared() : stride(0) {}
+
+    unsigned int stride;
+    std::vector<std::unique_ptr<SideSamples>> threads;
+  };
+
+  static std::map<std::pair<const SubProblem *, std::string>, Shared> & samplers();
+  static Shared & shared(const SubProblem & problem, const std::string & name);
+
+  const unsigned int _stride;
+
+  /// The declared vectors, in columnNames() order.
+  std::vector<VectorPostprocessorValue *> _columns;
+};
+
+#endif // INTERFACEHEATFLUXSAMPLER_H
@@ -7,8 +7,10 @@
 
 [Mesh]
   type = FileMesh
-  file = /home/ENP/staff/acahill/Projects/phoenix/problems/WAXTS_3mil_coating_1mps_init_Checkpoint_cp/3148_mesh.cpr
-  parallel_type = REPLICATED
+  file = /home/ENP/staff/acahill/Projects/phoenix/problems/WAXTS_3mil_coating_1mps_init_Checkpoint_cp/0100_mesh.cpr
+  # The init deck's final (100th) step, written split per rank by its
+  # Checkpoint, so restart on the same number of ranks.
+  parallel_type = DISTRIBUTED
 []
 
 [Problem]
@@ -182,6 +184,7 @@
     var_heat_flux_func = zero_function
     neighbor_heat_flux_func = Xe_profile
     radiation_temp = radiation_T
+    heat_flux_sampler = interface_flux_samples
   [../]
 []
 
@@ -469,20 +472,28 @@
   marker = dont_mark
   max_h_level = 1
   [./Indicators]
+    # One pass over the sides for every variable; each marker reads its
+    # variable's component.
+    [./grad_jump]
+      type = MultiVarGradientJumpIndicator
+      variable = rho
+      additional_variables = 'rhou rhov solid_temperature'
+      component_indicators = 'rho_grad_jump rhou_grad_jump rhov_grad_jump solid_temperature_grad_jump'
+    [../]
     [./rho_grad_jump]
-      type = VarRestrictedGradientJumpIndicator
+      type = GradientJumpComponentIndicator
       variable = rho
     [../]
     [./rhou_grad_jump]
-      type = VarRestrictedGradientJumpIndicator
+      type = GradientJumpComponentIndicator
       variable = rhou
     [../]
     [./rhov_grad_jump]
-      type = VarRestrictedGradientJumpIndicator
+      type = GradientJumpComponentIndicator
       variable = rhov
     [../]
     [./solid_temperature_grad_jump]
-      type = VarRestrictedGradientJumpIndicator
+      type = GradientJumpComponentIndicator
       variable = solid_temperature
     [../]
   [../]
@@ -526,6 +537,16 @@
   [../]
 []
 
+[VectorPostprocessors]
+  # The interface fluxes, streamed by the interface_flux output below so that
+  # the volume output can stay sparse.
+  [./interface_flux_samples]
+    type = InterfaceHeatFluxSampler
+    stride = 5
+    outputs = none
+  [../]
+[]
+
 [Outputs]
   print_perf_log = true
   [./Exodus]
@@ -533,7 +554,11 @@
     file_base = WAXTS_3mil_coating_1mps_restart_output
     execute_on = 'initial timestep_end final'
     output_material_properties = false
-    interval = 25
+    interval = 125
+  [../]
+  [./interface_flux]
+    type = InterfaceHeatFluxStream
+    sampler = interface_flux_samples
   [../]
   [./CONSOLE]
     type = Console
@@ -541,5 +566,10 @@
     output_nonlinear = true
     interval = 1
   [../]
+  [./async_checkpoint]
+    type = AsyncCheckpoint
+    num_files = 2
+    interval = 1
+  [../]
 []
 
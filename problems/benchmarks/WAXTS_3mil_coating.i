@@ -0,0 +1,500 @@
+# Scaled-down, self-contained version of WAXTS_3mil_coating_1mps_restart.i
+# for profiling.  The wind tunnel mesh and the checkpoint it restarts from
+# are replaced by a generated channel (wind_tunnel) under a steatite holder
+# carrying a coated aluminum coupon, and the run is cut to a few time steps
+# with adaptivity switched on so every phase is exercised.  Run it through
+# scripts/profile_problems.py.
+
+[GlobalParams]
+  family = LAGRANGE
+  order = FIRST
+  dynamic_viscosity = 1.846e-5
+  mu = 1.846e-5
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmax = 0.1
+  ymax = 0.02
+  nx = 80
+  ny = 32
+  block_id = '0 1 2 3'
+  block_name = 'wind_tunnel holder coupon coating'
+  parallel_type = DISTRIBUTED
+[]
+
+[MeshModifiers]
+  [./holder]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0 0.01 0'
+    top_right = '0.1 0.02 0'
+  [../]
+  [./coupon]
+    type = SubdomainBoundingBox
+    depends_on = holder
+    block_id = 2
+    bottom_left = '0.04 0.01 0'
+    top_right = '0.06 0.015 0'
+  [../]
+  [./coating]
+    type = SubdomainBoundingBox
+    depends_on = coupon
+    block_id = 3
+    bottom_left = '0.04 0.01 0'
+    top_right = '0.06 0.01125 0'
+  [../]
+  [./interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = coating
+    master_block = wind_tunnel
+    paired_block = 'holder coating'
+    new_boundary = interface
+  [../]
+  [./solid_interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = coating
+    master_block = 'holder coating'
+    paired_block = wind_tunnel
+    new_boundary = solid_interface
+  [../]
+  [./exterior]
+    type = SideSetsAroundSubdomain
+    depends_on = coating
+    block = holder
+    normal = '0 1 0'
+    new_boundary = exterior
+  [../]
+  [./inlet]
+    type = SideSetsAroundSubdomain
+    depends_on = coating
+    block = wind_tunnel
+    normal = '-1 0 0'
+    new_boundary = inlet
+  [../]
+  [./outlet]
+    type = SideSetsAroundSubdomain
+    depends_on = coating
+    block = wind_tunnel
+    normal = '1 0 0'
+    new_boundary = outlet
+  [../]
+  [./slip_wall]
+    type = SideSetsAroundSubdomain
+    depends_on = coating
+    block = wind_tunnel
+    normal = '0 -1 0'
+    new_boundary = slip_wall
+  [../]
+[]
+
+[Variables]
+  [./solid_temperature]
+    block = 'holder coupon coating'
+    initial_condition = 301.
+  [../]
+[]
+
+[AuxVariables]
+  [./global_temperature]
+    initial_condition = 300.
+  [../]
+[]
+
+[Functions]
+  [./Xe_profile]
+    type = ParsedVectorFunction
+    value_x = 0
+    value_y = 17.4e4*exp(-1*(x-mu)^2/(2*sigma^2))
+    value_z = 0
+    vars = 'mu sigma'
+    vals = '0.05 0.0058'
+  [../]
+  [./zero_function]
+    type = ParsedVectorFunction
+    value_x = 0
+    value_y = 0
+    value_z = 0
+  [../]
+[]
+
+[Kernels]
+  [./thermal_time]
+    type = SpecificHeatConductionTimeDerivative
+    variable = solid_temperature
+  [../]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = solid_temperature
+  [../]
+  [./rhou_viscous]
+    type = NSMomentumViscousFlux
+    variable = rhou
+    component = 0
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhov_viscous]
+    type = NSMomentumViscousFlux
+    variable = rhov
+    component = 1
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhoE_viscous]
+    type = NSEnergyViscousFlux
+    variable = rhoE
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhoE_thermal]
+    type = NSEnergyThermalFlux
+    variable = rhoE
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+    temperature = temperature
+  [../]
+[]
+
+[InterfaceKernels]
+  [./interface_flux]
+    type = NSThermalFluxInterface
+    variable = rhoE
+    neighbor_var = solid_temperature
+    boundary = interface
+    rho = rho
+    fluid_properties = ideal_gas
+    var_heat_flux_func = zero_function
+    neighbor_heat_flux_func = Xe_profile
+    radiation_temp = radiation_T
+  [../]
+[]
+
+[AuxKernels]
+  [./add_solid_to_global_T]
+    type = ParsedAux
+    function = solid_temperature
+    args = solid_temperature
+    variable = global_temperature
+    block = 'holder coupon coating'
+  [../]
+  [./add_fluid_to_global_T]
+    type = ParsedAux
+    function = temperature
+    args = temperature
+    variable = global_temperature
+    block = wind_tunnel
+  [../]
+[]
+
+[BCs]
+  [./rhou_viscous_interface]
+    type = NSMomentumViscousBC
+    variable = rhou
+    component = 0
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhov_viscous_interface]
+    type = NSMomentumViscousBC
+    variable = rhov
+    component = 1
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhoE_thermal_interface]
+    type = NSThermalMatchBC
+    variable = rhoE
+    v = solid_temperature
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    fluid_properties = ideal_gas
+  [../]
+  [./rhoE_viscous_interface]
+    type = NSEnergyViscousBC
+    variable = rhoE
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+    temperature = temperature
+  [../]
+  [./rhou_interface_velocity]
+    type = NSImposedVelocityBC
+    variable = rhou
+    rho = rho
+    desired_velocity = 0.
+    boundary = 'interface'
+  [../]
+  [./rhov_wall_velocity]
+    type = NSImposedVelocityBC
+    variable = rhov
+    rho = rho
+    desired_velocity = 0.
+    boundary = 'slip_wall interface'
+  [../]
+  [./rad_to_ambient]
+    type = RadiationBC
+    boundary = exterior
+    variable = solid_temperature
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./ideal_gas]
+      type = IdealGasFluidProperties
+      gamma = 1.4
+      R = 287
+      k = 2.57e-2
+    [../]
+  [../]
+  [./NavierStokes]
+    [./Variables]
+      # 'rho rhou rhov   rhoE'
+      scaling = '1.  1.    1.    9.869232667160121e-6'
+      family = LAGRANGE
+      order = FIRST
+      block = wind_tunnel
+    [../]
+    [./ICs]
+      initial_velocity = '1.04157 0 0' # Mach 0.003: = 0.003*sqrt(gamma*R*T)
+      initial_pressure = 101325.
+      initial_temperature = 300.
+      fluid_properties = ideal_gas
+    [../]
+    [./Kernels]
+      fluid_properties = ideal_gas
+    [../]
+    [./BCs]
+      [./inlet]
+        type = NSWeakStagnationInletBC
+        boundary = inlet
+        stagnation_pressure = 101325.63835 # Pa, Mach=0.003 at 1 atm
+        stagnation_temperature = 300.0066151 # K, Mach=0.003 at 1 atm
+        sx = 1.
+        sy = 0.
+        fluid_properties = ideal_gas
+      [../]
+      [./solid_walls]
+        type = NSNoPenetrationBC
+        boundary = 'slip_wall interface'
+        fluid_properties = ideal_gas
+      [../]
+      [./outlet]
+        type = NSStaticPressureOutletBC
+        boundary = outlet
+        specified_pressure = 101325 # Pa
+        fluid_properties = ideal_gas
+      [../]
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./fluid]
+    type = Air
+    block = wind_tunnel
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    temperature = temperature
+    enthalpy = enthalpy
+    fluid_properties = ideal_gas
+  [../]
+  [./holder]
+    type = Steatite
+    temperature = solid_temperature
+    block = holder
+  [../]
+  [./sample]
+    type = Aluminum2024
+    temperature = solid_temperature
+    block = 'coupon coating'
+  [../]
+[]
+
+[Postprocessors]
+  [./linear_iterations]
+    type = NumLinearIterations
+  [../]
+  [./total_linear_iterations]
+    type = CumulativeValuePostprocessor
+    postprocessor = linear_iterations
+  [../]
+  [./interface_temperature]
+    type = SideAverageValue
+    boundary = solid_interface
+    variable = solid_temperature
+  [../]
+  [./radiation_T]
+    type = SideAverageValue
+    execute_on = 'initial timestep_end'
+    boundary = interface
+    variable = global_temperature
+  [../]
+  [./material_time]
+    type = PhaseWallTime
+    phase = material
+  [../]
+  [./kernel_residual_time]
+    type = PhaseWallTime
+    phase = kernel_residual
+  [../]
+  [./kernel_jacobian_time]
+    type = PhaseWallTime
+    phase = kernel_jacobian
+  [../]
+  [./interface_residual_time]
+    type = PhaseWallTime
+    phase = interface_residual
+  [../]
+  [./interface_jacobian_time]
+    type = PhaseWallTime
+    phase = interface_jacobian
+  [../]
+  [./adaptivity_time]
+    type = PhaseWallTime
+    phase = adaptivity
+  [../]
+[]
+
+[ConjugatePreconditioning]
+  # Splits solid_temperature from the NS variables: AMG for the solid, ASM
+  # with ILU for the fluid, coupled multiplicatively.  The hand-written
+  # additive split this replaced can be run for comparison with
+  # scripts/compare_preconditioners.py.
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1e-6
+  dtmin = 1.e-12
+  dtmax = 1.e-5
+  num_steps = 5
+  nl_rel_tol = 1e-2
+  nl_abs_tol = 1e-3
+  nl_max_its = 10
+  l_tol = 1e-2
+  l_max_its = 25
+  [./TimeStepper]
+    type = SolutionTimeAdaptiveDT
+    dt = 1e-6
+  [../]
+  [./Quadrature]
+    type = TRAP
+    order = FIRST
+  [../]
+[]
+
+[Adaptivity]
+  marker = final_marker
+  max_h_level = 1
+  [./Indicators]
+    # One pass over the sides for every variable; each marker reads its
+    # variable's component.
+    [./grad_jump]
+      type = MultiVarGradientJumpIndicator
+      variable = rho
+      additional_variables = 'rhou rhov solid_temperature'
+      component_indicators = 'rho_grad_jump rhou_grad_jump rhov_grad_jump solid_temperature_grad_jump'
+    [../]
+    [./rho_grad_jump]
+      type = GradientJumpComponentIndicator
+      variable = rho
+    [../]
+    [./rhou_grad_jump]
+      type = GradientJumpComponentIndicator
+      variable = rhou
+    [../]
+    [./rhov_grad_jump]
+      type = GradientJumpComponentIndicator
+      variable = rhov
+    [../]
+    [./solid_temperature_grad_jump]
+      type = GradientJumpComponentIndicator
+      variable = solid_temperature
+    [../]
+  [../]
+  [./Markers]
+    [./rho_iefm]
+      type = InterfaceErrorFractionMarker
+      indicator = rho_grad_jump
+      boundary = interface
+      refine = 0.10
+      coarsen = 0.10
+    [../]
+    [./rhou_iefm]
+      type = InterfaceErrorFractionMarker
+      indicator = rhou_grad_jump
+      boundary = interface
+      refine = 0.10
+      coarsen = 0.10
+    [../]
+    [./rhov_iefm]
+      type = InterfaceErrorFractionMarker
+      indicator = rhov_grad_jump
+      boundary = interface
+      refine = 0.10
+      coarsen = 0.10
+    [../]
+    [./solid_temperature_iefm]
+      type = InterfaceErrorFractionMarker
+      indicator = solid_temperature_grad_jump
+      boundary = interface
+      refine = 0.10
+      coarsen = 0.10
+    [../]
+    [./final_marker]
+      type = ComboMarker
+      markers = 'rho_iefm rhou_iefm rhov_iefm solid_temperature_iefm'
+    [../]
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
@@ -0,0 +1,123 @@
+# Reference for coupon_stack_resistive.i: two Al 2024 coupons joined by an
+# 18 mil (0.4572 mm) paint layer, as in thermal_conductivity/coupon_stack.i,
+# with the paint meshed.  Two elements across the paint set the element size
+# for the whole stack.  Compare the two decks with
+#   ./scripts/compare_coating.py --executable ./phoenix-opt
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmax = 0.0132588
+  ymax = 0.0254
+  nx = 58
+  ny = 20
+  block_id = '0 1 2'
+  block_name = 'cold_coupon paint hot_coupon'
+[]
+
+[MeshModifiers]
+  [./paint]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.0064008 0 0'
+    top_right = '0.006858 0.0254 0'
+  [../]
+  [./hot_coupon]
+    type = SubdomainBoundingBox
+    depends_on = paint
+    block_id = 2
+    bottom_left = '0.006858 0 0'
+    top_right = '0.0132588 0.0254 0'
+  [../]
+  [./cold_face]
+    type = SideSetsBetweenSubdomains
+    depends_on = hot_coupon
+    master_block = cold_coupon
+    paired_block = paint
+    new_boundary = cold_face
+  [../]
+  [./hot_face]
+    type = SideSetsBetweenSubdomains
+    depends_on = hot_coupon
+    master_block = hot_coupon
+    paired_block = paint
+    new_boundary = hot_face
+  [../]
+[]
+
+[Variables]
+  [./temperature]
+    initial_condition = 300.
+  [../]
+[]
+
+[Kernels]
+  [./ThermalDiffusion]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[Materials]
+  [./Al2024]
+    type = Aluminum2024
+    temperature = temperature
+    block = 'cold_coupon hot_coupon'
+  [../]
+  [./paint]
+    type = GenericConstantMaterial
+    prop_names = 'thermal_conductivity dthermal_conductivity/dtemperature'
+    prop_values = '1. 0.'
+    block = paint
+  [../]
+[]
+
+[BCs]
+  [./cold_side]
+    type = DirichletBC
+    variable = temperature
+    boundary = left
+    value = 300.
+  [../]
+  [./hot_side]
+    type = DirichletBC
+    variable = temperature
+    boundary = right
+    value = 450.
+  [../]
+[]
+
+[Postprocessors]
+  [./heat_flux]
+    type = SideFluxIntegral
+    variable = temperature
+    boundary = left
+    diffusivity = thermal_conductivity
+  [../]
+  [./cold_face_temperature]
+    type = SideAverageValue
+    variable = temperature
+    boundary = cold_face
+  [../]
+  [./hot_face_temperature]
+    type = SideAverageValue
+    variable = temperature
+    boundary = hot_face
+  [../]
+  [./elements]
+    type = NumElems
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    event = ACTIVE
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
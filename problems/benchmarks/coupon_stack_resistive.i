@@ -0,0 +1,141 @@
+# coupon_stack_meshed.i with the paint replaced by a ResistiveThermalInterface
+# between the coupons.  The paint no longer sets the element size, so the
+# coupons are meshed as coarsely as their own gradients allow.  The
+# temperature on either side of the paint is a separate variable.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmax = 0.0128016
+  ymax = 0.0254
+  nx = 8
+  ny = 4
+  block_id = '0 2'
+  block_name = 'cold_coupon hot_coupon'
+[]
+
+[MeshModifiers]
+  [./hot_coupon]
+    type = SubdomainBoundingBox
+    block_id = 2
+    bottom_left = '0.0064008 0 0'
+    top_right = '0.0128016 0.0254 0'
+  [../]
+  [./cold_face]
+    type = SideSetsBetweenSubdomains
+    depends_on = hot_coupon
+    master_block = cold_coupon
+    paired_block = hot_coupon
+    new_boundary = cold_face
+  [../]
+  [./hot_face]
+    type = SideSetsBetweenSubdomains
+    depends_on = hot_coupon
+    master_block = hot_coupon
+    paired_block = cold_coupon
+    new_boundary = hot_face
+  [../]
+[]
+
+[Variables]
+  [./cold_temperature]
+    block = cold_coupon
+    initial_condition = 300.
+  [../]
+  [./hot_temperature]
+    block = hot_coupon
+    initial_condition = 300.
+  [../]
+[]
+
+[Kernels]
+  [./cold_diffusion]
+    type = HeatConductionDMI
+    variable = cold_temperature
+  [../]
+  [./hot_diffusion]
+    type = HeatConductionDMI
+    variable = hot_temperature
+  [../]
+[]
+
+[InterfaceKernels]
+  [./paint]
+    type = ResistiveThermalInterface
+    variable = cold_temperature
+    neighbor_var = hot_temperature
+    boundary = cold_face
+    conductivity = 1.
+    thickness = 4.572e-4
+  [../]
+[]
+
+[Materials]
+  [./cold_coupon]
+    type = Aluminum2024
+    temperature = cold_temperature
+    block = cold_coupon
+  [../]
+  [./hot_coupon]
+    type = Aluminum2024
+    temperature = hot_temperature
+    block = hot_coupon
+  [../]
+[]
+
+[BCs]
+  [./cold_side]
+    type = DirichletBC
+    variable = cold_temperature
+    boundary = left
+    value = 300.
+  [../]
+  [./hot_side]
+    type = DirichletBC
+    variable = hot_temperature
+    boundary = right
+    value = 450.
+  [../]
+[]
+
+[Postprocessors]
+  [./heat_flux]
+    type = SideFluxIntegral
+    variable = cold_temperature
+    boundary = left
+    diffusivity = thermal_conductivity
+  [../]
+  [./cold_face_temperature]
+    type = SideAverageValue
+    variable = cold_temperature
+    boundary = cold_face
+  [../]
+  [./hot_face_temperature]
+    type = SideAverageValue
+    variable = hot_temperature
+    boundary = hot_face
+  [../]
+  [./elements]
+    type = NumElems
+  [../]
+  [./solve_time]
+    type = PerformanceData
+    event = ACTIVE
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,443 @@
+# Scaled-down, self-contained version of long_turbine_restart.i for
+# profiling.  The turbine mesh and the checkpoint it restarts from are
+# replaced by a generated channel (fluid) under a heated plate (solid), and
+# the run is cut to a few time steps with adaptivity switched on so every
+# phase is exercised.  Run it through scripts/profile_problems.py.
+
+[GlobalParams]
+  family = LAGRANGE
+  order = FIRST
+  dynamic_viscosity = 1.846e-5
+  mu = 1.846e-5
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmax = 0.2
+  ymax = 0.02
+  nx = 80
+  ny = 16
+  block_id = '0 1'
+  block_name = 'fluid solid'
+  parallel_type = DISTRIBUTED
+[]
+
+[MeshModifiers]
+  [./solid]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0 0.01 0'
+    top_right = '0.2 0.02 0'
+  [../]
+  [./interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = solid
+    master_block = fluid
+    paired_block = solid
+    new_boundary = interface
+  [../]
+  [./inlet]
+    type = SideSetsAroundSubdomain
+    depends_on = solid
+    block = fluid
+    normal = '-1 0 0'
+    new_boundary = inlet
+  [../]
+  [./outlet]
+    type = SideSetsAroundSubdomain
+    depends_on = solid
+    block = fluid
+    normal = '1 0 0'
+    new_boundary = outlet
+  [../]
+  [./wall]
+    type = SideSetsAroundSubdomain
+    depends_on = solid
+    block = fluid
+    normal = '0 -1 0'
+    new_boundary = wall
+  [../]
+[]
+
+[Variables]
+  [./solid_temperature]
+    block = solid
+    initial_condition = 2000.
+  [../]
+[]
+
+[AuxVariables]
+  [./global_temperature]
+    initial_condition = 2000.
+  [../]
+[]
+
+[Functions]
+  [./zero_function]
+    type = ParsedVectorFunction
+    value_x = 0
+    value_y = 0
+    value_z = 0
+  [../]
+[]
+
+[Kernels]
+  [./thermal_time]
+    type = SpecificHeatConductionTimeDerivative
+    variable = solid_temperature
+  [../]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = solid_temperature
+  [../]
+  [./decay_heat_source]
+    type = HeatSource
+    variable = solid_temperature
+    value = 19.04e6 # W / m^3
+  [../]
+  [./rhou_viscous]
+    type = NSMomentumViscousFlux
+    variable = rhou
+    component = 0
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhov_viscous]
+    type = NSMomentumViscousFlux
+    variable = rhov
+    component = 1
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhoE_viscous]
+    type = NSEnergyViscousFlux
+    variable = rhoE
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhoE_thermal]
+    type = NSEnergyThermalFlux
+    variable = rhoE
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+    temperature = temperature
+  [../]
+[]
+
+[InterfaceKernels]
+  [./interface_flux]
+    type = NSThermalFluxInterface
+    variable = rhoE
+    neighbor_var = solid_temperature
+    boundary = interface
+    rho = rho
+    fluid_properties = ideal_gas
+    var_heat_flux_func = zero_function
+    neighbor_heat_flux_func = zero_function
+    radiation_temp = radiation_T
+  [../]
+[]
+
+[AuxKernels]
+  [./add_solid_to_global_T]
+    type = ParsedAux
+    function = solid_temperature
+    args = solid_temperature
+    variable = global_temperature
+    block = solid
+  [../]
+  [./add_fluid_to_global_T]
+    type = ParsedAux
+    function = temperature
+    args = temperature
+    variable = global_temperature
+    block = fluid
+  [../]
+[]
+
+[BCs]
+  [./rhou_viscous_interface]
+    type = NSMomentumViscousBC
+    variable = rhou
+    component = 0
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhov_viscous_interface]
+    type = NSMomentumViscousBC
+    variable = rhov
+    component = 1
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhoE_thermal_interface]
+    type = NSThermalMatchBC
+    variable = rhoE
+    v = solid_temperature
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    fluid_properties = ideal_gas
+  [../]
+  [./rhoE_viscous_interface]
+    type = NSEnergyViscousBC
+    variable = rhoE
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+    temperature = temperature
+  [../]
+  [./rhou_interface_velocity]
+    type = NSImposedVelocityBC
+    variable = rhou
+    rho = rho
+    desired_velocity = 0.
+    boundary = 'interface'
+  [../]
+  [./rhov_wall_velocity]
+    type = NSImposedVelocityBC
+    variable = rhov
+    rho = rho
+    desired_velocity = 0.
+    boundary = 'interface wall inlet'
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./ideal_gas]
+      type = IdealGasFluidProperties
+      gamma = 1.4
+      R = 287
+      k = 2.57e-2
+    [../]
+  [../]
+  [./NavierStokes]
+    [./Variables]
+      # 'rho rhou rhov   rhoE'
+      scaling = '1.  1.    1.    9.869232667160121e-6'
+      family = LAGRANGE
+      order = FIRST
+      block = fluid
+    [../]
+    [./ICs]
+      initial_velocity = '42 0 0' # M = v / sqrt(gamma*R*T) = 0.047
+      initial_pressure = 101325.
+      initial_temperature = 1750.
+      fluid_properties = ideal_gas
+    [../]
+    [./Kernels]
+      fluid_properties = ideal_gas
+    [../]
+    [./BCs]
+      [./inlet]
+        type = NSWeakStagnationInletBC
+        boundary = inlet
+        stagnation_pressure = 101482. # Pa, M = 0.047 at 101325 Pa
+        stagnation_temperature = 1501. # K, M = 0.047 at 101325 Pa
+        sx = 1.
+        sy = 0.
+        fluid_properties = ideal_gas
+      [../]
+      [./solid_walls]
+        type = NSNoPenetrationBC
+        boundary = 'wall interface'
+        fluid_properties = ideal_gas
+      [../]
+      [./outlet]
+        type = NSStaticPressureOutletBC
+        boundary = outlet
+        specified_pressure = 101325 # Pa
+        fluid_properties = ideal_gas
+      [../]
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./fluid]
+    type = Air
+    block = fluid
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    temperature = temperature
+    enthalpy = enthalpy
+    fluid_properties = ideal_gas
+  [../]
+  [./solid]
+    type = GenericConstantMaterial
+    block = solid
+    prop_names = 'thermal_conductivity density specific_heat epsilon'
+    prop_values = '1.5475 8880 163. 1.0'
+  [../]
+[]
+
+[Postprocessors]
+  [./linear_iterations]
+    type = NumLinearIterations
+  [../]
+  [./total_linear_iterations]
+    type = CumulativeValuePostprocessor
+    postprocessor = linear_iterations
+  [../]
+  [./radiation_T]
+    type = SideAverageValue
+    execute_on = 'initial timestep_end'
+    boundary = interface
+    variable = global_temperature
+  [../]
+  [./material_time]
+    type = PhaseWallTime
+    phase = material
+  [../]
+  [./kernel_residual_time]
+    type = PhaseWallTime
+    phase = kernel_residual
+  [../]
+  [./kernel_jacobian_time]
+    type = PhaseWallTime
+    phase = kernel_jacobian
+  [../]
+  [./interface_residual_time]
+    type = PhaseWallTime
+    phase = interface_residual
+  [../]
+  [./interface_jacobian_time]
+    type = PhaseWallTime
+    phase = interface_jacobian
+  [../]
+  [./adaptivity_time]
+    type = PhaseWallTime
+    phase = adaptivity
+  [../]
+[]
+
+[ConjugatePreconditioning]
+  # Splits solid_temperature from the NS variables: AMG for the solid, ASM
+  # with ILU for the fluid, coupled multiplicatively.  The hand-written
+  # additive split this replaced can be run for comparison with
+  # scripts/compare_preconditioners.py.
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1e-6
+  dtmin = 1.e-12
+  dtmax = 1.e-5
+  num_steps = 5
+  nl_rel_tol = 1e-2
+  nl_abs_tol = 1e-3
+  nl_max_its = 10
+  l_tol = 1e-2
+  l_max_its = 25
+  [./TimeStepper]
+    type = SolutionTimeAdaptiveDT
+    dt = 1e-7
+  [../]
+  [./Quadrature]
+    type = TRAP
+    order = FIRST
+  [../]
+[]
+
+[Adaptivity]
+  marker = final_marker
+  max_h_level = 1
+  [./Indicators]
+    # One pass over the sides for every variable; each marker reads its
+    # variable's component.
+    [./grad_jump]
+      type = MultiVarGradientJumpIndicator
+      variable = rho
+      additional_variables = 'rhou rhov'
+      component_indicators = 'rho_grad_jump rhou_grad_jump rhov_grad_jump'
+    [../]
+    [./rho_grad_jump]
+      type = GradientJumpComponentIndicator
+      variable = rho
+    [../]
+    [./rhou_grad_jump]
+      type = GradientJumpComponentIndicator
+      variable = rhou
+    [../]
+    [./rhov_grad_jump]
+      type = GradientJumpComponentIndicator
+      variable = rhov
+    [../]
+  [../]
+  [./Markers]
+    [./rho_iefm]
+      type = InterfaceErrorFractionMarker
+      indicator = rho_grad_jump
+      boundary = interface
+      refine = 0.10
+      coarsen = 0.10
+    [../]
+    [./rhou_iefm]
+      type = InterfaceErrorFractionMarker
+      indicator = rhou_grad_jump
+      boundary = interface
+      refine = 0.10
+      coarsen = 0.10
+    [../]
+    [./rhov_iefm]
+      type = InterfaceErrorFractionMarker
+      indicator = rhov_grad_jump
+      boundary = interface
+      refine = 0.10
+      coarsen = 0.10
+    [../]
+    [./final_marker]
+      type = ComboMarker
+      markers = 'rho_iefm rhou_iefm rhov_iefm'
+    [../]
+  [../]
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
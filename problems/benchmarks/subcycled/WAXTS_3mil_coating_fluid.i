@@ -0,0 +1,314 @@
+# The fluid of ../WAXTS_3mil_coating.i, run as the sub-app of
+# WAXTS_3mil_coating_solid.i.  The wall temperature comes from the solid
+# and is matched with NSThermalMatchBC; the wall heat flux goes back to the
+# solid in wall_heat_flux.
+
+[GlobalParams]
+  family = LAGRANGE
+  order = FIRST
+  dynamic_viscosity = 1.846e-5
+  mu = 1.846e-5
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmax = 0.1
+  ymax = 0.02
+  nx = 80
+  ny = 32
+  block_id = '0 1 2 3'
+  block_name = 'wind_tunnel holder coupon coating'
+  parallel_type = REPLICATED
+[]
+
+[MeshModifiers]
+  [./holder]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0 0.01 0'
+    top_right = '0.1 0.02 0'
+  [../]
+  [./coupon]
+    type = SubdomainBoundingBox
+    depends_on = holder
+    block_id = 2
+    bottom_left = '0.04 0.01 0'
+    top_right = '0.06 0.015 0'
+  [../]
+  [./coating]
+    type = SubdomainBoundingBox
+    depends_on = coupon
+    block_id = 3
+    bottom_left = '0.04 0.01 0'
+    top_right = '0.06 0.01125 0'
+  [../]
+  [./interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = coating
+    master_block = wind_tunnel
+    paired_block = 'holder coating'
+    new_boundary = interface
+  [../]
+  [./inlet]
+    type = SideSetsAroundSubdomain
+    depends_on = coating
+    block = wind_tunnel
+    normal = '-1 0 0'
+    new_boundary = inlet
+  [../]
+  [./outlet]
+    type = SideSetsAroundSubdomain
+    depends_on = coating
+    block = wind_tunnel
+    normal = '1 0 0'
+    new_boundary = outlet
+  [../]
+  [./slip_wall]
+    type = SideSetsAroundSubdomain
+    depends_on = coating
+    block = wind_tunnel
+    normal = '0 -1 0'
+    new_boundary = slip_wall
+  [../]
+[]
+
+[Problem]
+  # The solid blocks belong to the master app.
+  kernel_coverage_check = false
+  material_coverage_check = false
+[]
+
+[AuxVariables]
+  [./wall_temperature]
+    initial_condition = 301.
+  [../]
+  [./wall_heat_flux]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[Kernels]
+  [./rhou_viscous]
+    type = NSMomentumViscousFlux
+    variable = rhou
+    component = 0
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhov_viscous]
+    type = NSMomentumViscousFlux
+    variable = rhov
+    component = 1
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhoE_viscous]
+    type = NSEnergyViscousFlux
+    variable = rhoE
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhoE_thermal]
+    type = NSEnergyThermalFlux
+    variable = rhoE
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+    temperature = temperature
+  [../]
+[]
+
+[AuxKernels]
+  [./wall_heat_flux]
+    type = NSWallHeatFluxAux
+    variable = wall_heat_flux
+    boundary = interface
+    rho = rho
+    rhoE = rhoE
+    fluid_properties = ideal_gas
+  [../]
+[]
+
+[BCs]
+  [./rhou_viscous_interface]
+    type = NSMomentumViscousBC
+    variable = rhou
+    component = 0
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhov_viscous_interface]
+    type = NSMomentumViscousBC
+    variable = rhov
+    component = 1
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+  [../]
+  [./rhoE_thermal_interface]
+    type = NSThermalMatchBC
+    variable = rhoE
+    v = wall_temperature
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    fluid_properties = ideal_gas
+  [../]
+  [./rhoE_viscous_interface]
+    type = NSEnergyViscousBC
+    variable = rhoE
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    fluid_properties = ideal_gas
+    temperature = temperature
+  [../]
+  [./rhou_interface_velocity]
+    type = NSImposedVelocityBC
+    variable = rhou
+    rho = rho
+    desired_velocity = 0.
+    boundary = 'interface'
+  [../]
+  [./rhov_wall_velocity]
+    type = NSImposedVelocityBC
+    variable = rhov
+    rho = rho
+    desired_velocity = 0.
+    boundary = 'slip_wall interface'
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./ideal_gas]
+      type = IdealGasFluidProperties
+      gamma = 1.4
+      R = 287
+      k = 2.57e-2
+    [../]
+  [../]
+  [./NavierStokes]
+    [./Variables]
+      # 'rho rhou rhov   rhoE'
+      scaling = '1.  1.    1.    9.869232667160121e-6'
+      family = LAGRANGE
+      order = FIRST
+      block = wind_tunnel
+    [../]
+    [./ICs]
+      initial_velocity = '1.04157 0 0' # Mach 0.003: = 0.003*sqrt(gamma*R*T)
+      initial_pressure = 101325.
+      initial_temperature = 300.
+      fluid_properties = ideal_gas
+    [../]
+    [./Kernels]
+      fluid_properties = ideal_gas
+    [../]
+    [./BCs]
+      [./inlet]
+        type = NSWeakStagnationInletBC
+        boundary = inlet
+        stagnation_pressure = 101325.63835 # Pa, Mach=0.003 at 1 atm
+        stagnation_temperature = 300.0066151 # K, Mach=0.003 at 1 atm
+        sx = 1.
+        sy = 0.
+        fluid_properties = ideal_gas
+      [../]
+      [./solid_walls]
+        type = NSNoPenetrationBC
+        boundary = 'slip_wall interface'
+        fluid_properties = ideal_gas
+      [../]
+      [./outlet]
+        type = NSStaticPressureOutletBC
+        boundary = outlet
+        specified_pressure = 101325 # Pa
+        fluid_properties = ideal_gas
+      [../]
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./fluid]
+    type = Air
+    block = wind_tunnel
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    vel_x = vel_x
+    vel_y = vel_y
+    temperature = temperature
+    enthalpy = enthalpy
+    fluid_properties = ideal_gas
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+    solve_type = PJFNK
+    petsc_options_iname = '-pc_type -pc_hypre_type'
+    petsc_options_value = 'hypre boomeramg'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1e-6
+  dtmin = 1.e-12
+  dtmax = 1.e-5
+  nl_rel_tol = 1e-2
+  nl_abs_tol = 1e-3
+  nl_max_its = 10
+  l_tol = 1e-2
+  l_max_its = 25
+  [./TimeStepper]
+    type = SolutionTimeAdaptiveDT
+    dt = 1e-6
+  [../]
+  [./Quadrature]
+    type = TRAP
+    order = FIRST
+  [../]
+[]
@@ -0,0 +1,203 @@
+# The solid of ../WAXTS_3mil_coating.i solved on its own, at time steps
+# suited to the aluminum and steatite, with the fluid run as a sub-app
+# (WAXTS_3mil_coating_fluid.i) that subcycles at the fluid time step.
+#
+# At the start of each solid step the wall temperature is handed to the
+# fluid, which matches it with NSThermalMatchBC and advances to the end of
+# the step; the wall heat flux it computes comes back and is applied with
+# ConjugateHeatFluxBC, which also carries the external heating and
+# radiation of NSThermalFluxInterface.  Both apps use the same mesh, each
+# solving only on its own blocks.  Compare against the monolithic deck with
+#   ./scripts/compare_subcycling.py --executable ./phoenix-opt
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmax = 0.1
+  ymax = 0.02
+  nx = 80
+  ny = 32
+  block_id = '0 1 2 3'
+  block_name = 'wind_tunnel holder coupon coating'
+  parallel_type = REPLICATED
+[]
+
+[MeshModifiers]
+  [./holder]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0 0.01 0'
+    top_right = '0.1 0.02 0'
+  [../]
+  [./coupon]
+    type = SubdomainBoundingBox
+    depends_on = holder
+    block_id = 2
+    bottom_left = '0.04 0.01 0'
+    top_right = '0.06 0.015 0'
+  [../]
+  [./coating]
+    type = SubdomainBoundingBox
+    depends_on = coupon
+    block_id = 3
+    bottom_left = '0.04 0.01 0'
+    top_right = '0.06 0.01125 0'
+  [../]
+  [./solid_interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = coating
+    master_block = 'holder coating'
+    paired_block = wind_tunnel
+    new_boundary = solid_interface
+  [../]
+  [./exterior]
+    type = SideSetsAroundSubdomain
+    depends_on = coating
+    block = holder
+    normal = '0 1 0'
+    new_boundary = exterior
+  [../]
+[]
+
+[Problem]
+  # The fluid block belongs to the sub-app.
+  kernel_coverage_check = false
+  material_coverage_check = false
+[]
+
+[Variables]
+  [./solid_temperature]
+    block = 'holder coupon coating'
+    initial_condition = 301.
+  [../]
+[]
+
+[AuxVariables]
+  # Constant on each element, like the wall_heat_flux of the fluid, so that
+  # every solid wall element takes the flux of the fluid element across
+  # from it.
+  [./fluid_heat_flux]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[Functions]
+  [./Xe_profile]
+    type = ParsedVectorFunction
+    value_x = 0
+    value_y = 17.4e4*exp(-1*(x-mu)^2/(2*sigma^2))
+    value_z = 0
+    vars = 'mu sigma'
+    vals = '0.05 0.0058'
+  [../]
+[]
+
+[Kernels]
+  [./thermal_time]
+    type = SpecificHeatConductionTimeDerivative
+    variable = solid_temperature
+  [../]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = solid_temperature
+  [../]
+[]
+
+[BCs]
+  [./fluid_interface]
+    type = ConjugateHeatFluxBC
+    variable = solid_temperature
+    boundary = solid_interface
+    heat_flux = fluid_heat_flux
+    heat_flux_func = Xe_profile
+    radiation_temp = radiation_T
+  [../]
+  [./rad_to_ambient]
+    type = RadiationBC
+    boundary = exterior
+    variable = solid_temperature
+  [../]
+[]
+
+[Materials]
+  [./holder]
+    type = Steatite
+    temperature = solid_temperature
+    block = holder
+  [../]
+  [./sample]
+    type = Aluminum2024
+    temperature = solid_temperature
+    block = 'coupon coating'
+  [../]
+[]
+
+[MultiApps]
+  [./fluid]
+    type = TransientMultiApp
+    app_type = PhoenixApp
+    input_files = WAXTS_3mil_coating_fluid.i
+    execute_on = timestep_begin
+    sub_cycling = true
+    positions = '0 0 0'
+  [../]
+[]
+
+[Transfers]
+  [./wall_temperature]
+    type = MultiAppNearestNodeTransfer
+    direction = to_multiapp
+    multi_app = fluid
+    source_variable = solid_temperature
+    variable = wall_temperature
+    source_boundary = solid_interface
+    target_boundary = interface
+    fixed_meshes = true
+  [../]
+  # Between elemental variables the nearest "node" is the element centroid.
+  # The apps share the mesh, so the fluid centroid nearest to that of a solid
+  # wall element is the one across the wall, and the solid receives exactly
+  # the flux of each wall side: the total heat is conserved.  (Into a nodal
+  # variable, each wall node would take one of the two fluid elements beside
+  # it, shifting the flux by half an element.)
+  [./wall_heat_flux]
+    type = MultiAppNearestNodeTransfer
+    direction = from_multiapp
+    multi_app = fluid
+    source_variable = wall_heat_flux
+    variable = fluid_heat_flux
+    source_boundary = interface
+    target_boundary = solid_interface
+    fixed_meshes = true
+  [../]
+[]
+
+[Postprocessors]
+  [./interface_temperature]
+    type = SideAverageValue
+    boundary = solid_interface
+    variable = solid_temperature
+  [../]
+  [./radiation_T]
+    type = SideAverageValue
+    execute_on = 'initial timestep_end'
+    boundary = solid_interface
+    variable = solid_temperature
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 1e-5
+  end_time = 2e-5
+  nl_rel_tol = 1e-6
+  petsc_options_iname = '-pc_type -pc_hypre_type'
+  petsc_options_value = 'hypre boomeramg'
+[]
+
+[Outputs]
+  csv = true
+  print_perf_log = true
+[]
@@ -9,6 +9,7 @@
   type = FileMesh
   file = /home/acahill/Projects/phoenix/meshes/long_turbine.e
   uniform_refine = 0
+  parallel_type = DISTRIBUTED
 []
 
 [Variables]
@@ -44,6 +45,32 @@
     type = HeatConductionDMI
     variable = solid_temperature
   [../]
+  # Pseudo-transient continuation: with the time derivatives above and the
+  # ones the NavierStokes action adds, every element advances with its own
+  # pseudo-time step (see the local_time_step materials), so dt is only a
+  # step counter and the CFL number is ramped by the cfl postprocessor.
+  [./rho_local_time]
+    type = LocalTimeStepDerivative
+    variable = rho
+  [../]
+  [./rhou_local_time]
+    type = LocalTimeStepDerivative
+    variable = rhou
+  [../]
+  [./rhov_local_time]
+    type = LocalTimeStepDerivative
+    variable = rhov
+  [../]
+  [./rhoE_local_time]
+    type = LocalTimeStepDerivative
+    variable = rhoE
+  [../]
+  [./thermal_local_time]
+    type = LocalTimeStepDerivative
+    variable = solid_temperature
+    density = density
+    specific_heat = specific_heat
+  [../]
   [./decay_heat_source]
 		type = HeatSource
 		variable = solid_temperature
@@ -273,6 +300,21 @@
 		prop_names = 'thermal_conductivity density specific_heat epsilon'
 		prop_values = '1.5475 8880 163. 1.0'
 	[../]
+  [./fluid_local_time_step]
+    type = LocalTimeStepMaterial
+    block = fluid
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoE = rhoE
+    fluid_properties = ideal_gas
+    cfl = cfl
+  [../]
+  [./solid_local_time_step]
+    type = LocalTimeStepMaterial
+    block = solid
+    cfl = cfl
+  [../]
 []
 
 [Postprocessors]
@@ -292,6 +334,12 @@
     boundary = interface
     variable = global_temperature
   [../]
+  [./cfl]
+    type = SERCFLNumber
+    cfl_initial = 1.
+    cfl_max = 1e4
+    execute_on = 'initial timestep_end'
+  [../]
 []
 
 [Preconditioning]
@@ -343,11 +391,18 @@
   nl_max_its = 10
   l_tol = 1e-2 # 1e-4
   l_max_its = 25
+  # Steps are in pseudo-time (see LocalTimeStepDerivative), so a fixed dt
+  # keeps the end time, and hence the restart decks, unchanged.  This deck
+  # is only the first leg of the march: the restart deck carries the same
+  # pseudo-transient on from its final step, so it need not reach steady
+  # state itself, only hand over at a known step.  num_steps pins that step
+  # (1e-3 / 1e-5 = 100), which the restart deck reads its mesh from.
+  num_steps = 100
   trans_ss_check = false
   ss_check_tol = 1e-9
   [./TimeStepper]
-    type = SolutionTimeAdaptiveDT
-    dt = 1e-7
+    type = ConstantDT
+    dt = 1e-5
   [../]
   [./Quadrature]
     type = TRAP
@@ -359,20 +414,28 @@
   marker = dont_mark
   max_h_level = 1
   [./Indicators]
+    # One pass over the sides for every variable; each marker reads its
+    # variable's component.
+    [./grad_jump]
+      type = MultiVarGradientJumpIndicator
+      variable = rho
+      additional_variables = 'rhou rhov solid_temperature'
+      component_indicators = 'rho_grad_jump rhou_grad_jump rhov_grad_jump solid_temperature_grad_jump'
+    [../]
     [./rho_grad_jump]
-      type = VarRestrictedGradientJumpIndicator
+      type = GradientJumpComponentIndicator
       variable = rho
     [../]
     [./rhou_grad_jump]
-      type = VarRestrictedGradientJumpIndicator
+      type = GradientJumpComponentIndicator
       variable = rhou
     [../]
     [./rhov_grad_jump]
-      type = VarRestrictedGradientJumpIndicator
+      type = GradientJumpComponentIndicator
       variable = rhov
     [../]
     [./solid_temperature_grad_jump]
-      type = VarRestrictedGradientJumpIndicator
+      type = GradientJumpComponentIndicator
       variable = solid_temperature
     [../]
   [../]
@@ -431,9 +494,16 @@
     output_nonlinear = true
     interval = 1
   [../]
+	# The restart deck starts from this one; the asynchronous checkpoints
+	# below are for resuming an interrupted run (resume = true).
 	[./Checkpoint]
 		type = Checkpoint
 		num_files = 2
+		execute_on = final
+	[../]
+	[./async_checkpoint]
+		type = AsyncCheckpoint
+		num_files = 2
 		interval = 1
 	[../]
 []
@@ -7,8 +7,10 @@
 
 [Mesh]
   type = FileMesh
-  file = /home/ENP/staff/acahill/Projects/phoenix/long_turbine_init_Checkpoint_cp/0695_mesh.cpr
-  parallel_type = REPLICATED
+  file = /home/ENP/staff/acahill/Projects/phoenix/long_turbine_init_Checkpoint_cp/0100_mesh.cpr
+  # The init deck's final (100th) step, written split per rank by its
+  # Checkpoint, so restart on the same number of ranks.
+  parallel_type = DISTRIBUTED
 []
 
 [Problem]
@@ -172,10 +174,24 @@
     fluid_properties = ideal_gas
     var_heat_flux_func = zero_function
     neighbor_heat_flux_func = zero_function
-    radiation_temp = radiation_T
+    radiation_exchange = surface_radiation
+    heat_flux_sampler = interface_flux_samples
   [../]
 []
 
+[UserObjects]
+  # The facing blade surfaces see each other, radiating with the solid's
+  # epsilon; what they do not see goes to radiation_T.  The view factors
+  # are computed on the first run and read back from the file by later
+  # restarts on the same mesh.
+  [./surface_radiation]
+    type = SurfaceRadiationExchange
+    boundary = interface
+    variable = solid_temperature
+    ambient_temp = radiation_T
+    view_factor_file = long_turbine_view_factors.bin
+  [../]
+[]
 
 [AuxKernels]
   [./add_solid_to_global_T]
@@ -423,20 +439,28 @@
   marker = dont_mark
   max_h_level = 1
   [./Indicators]
+    # One pass over the sides for every variable; each marker reads its
+    # variable's component.
+    [./grad_jump]
+      type = MultiVarGradientJumpIndicator
+      variable = rho
+      additional_variables = 'rhou rhov solid_temperature'
+      component_indicators = 'rho_grad_jump rhou_grad_jump rhov_grad_jump solid_temperature_grad_jump'
+    [../]
     [./rho_grad_jump]
-      type = VarRestrictedGradientJumpIndicator
+      type = GradientJumpComponentIndicator
       variable = rho
     [../]
     [./rhou_grad_jump]
-      type = VarRestrictedGradientJumpIndicator
+      type = GradientJumpComponentIndicator
       variable = rhou
     [../]
     [./rhov_grad_jump]
-      type = VarRestrictedGradientJumpIndicator
+      type = GradientJumpComponentIndicator
       variable = rhov
     [../]
     [./solid_temperature_grad_jump]
-      type = VarRestrictedGradientJumpIndicator
+      type = GradientJumpComponentIndicator
       variable = solid_temperature
     [../]
   [../]
@@ -480,6 +504,16 @@
   [../]
 []
 
+[VectorPostprocessors]
+  # The interface fluxes, streamed by the interface_flux output below so that
+  # the volume output can stay sparse.
+  [./interface_flux_samples]
+    type = InterfaceHeatFluxSampler
+    stride = 10
+    outputs = none
+  [../]
+[]
+
 [Outputs]
   print_perf_log = true
   [./Exodus]
@@ -487,7 +521,11 @@
     file_base = long_turbine_restart
     execute_on = 'initial timestep_end final'
     output_material_properties = false
-    interval = 50
+    interval = 250
+  [../]
+  [./interface_flux]
+    type = InterfaceHeatFluxStream
+    sampler = interface_flux_samples
   [../]
   [./CONSOLE]
     type = Console
@@ -495,9 +533,16 @@
     output_nonlinear = true
     interval = 1
   [../]
+  # Checkpoint feeds the next run of a restart chain; async_checkpoint is
+  # for resuming this one if it is interrupted (resume = true).
   [./Checkpoint]
     type = Checkpoint
     num_files = 2
+    execute_on = final
+  [../]
+  [./async_checkpoint]
+    type = AsyncCheckpoint
+    num_files = 2
     interval = 1
   [../]
 []
@@ -0,0 +1,82 @@
+# coupon_stack.i swept over the paint conductivity and the side
+# temperatures in one run; see SteadySweep.  Each row of sweep_file is one
+# point, and the heat flux through the stack at each lands in
+# coupon_stack_sweep_out_sweep.csv.  Large sweeps are split over several
+# runs by
+#   ./scripts/sweep_coupon_stack.py --executable ./phoenix-opt --jobs 4
+
+[Mesh]
+  type = FileMesh
+  file = /home/ENP/staff/achaill/Projects/phoenix/meshes/couponStack_18mil.e
+[]
+
+[Variables]
+  [./temperature]
+    initial_condition = 300.
+  [../]
+[]
+
+[Kernels]
+  [./ThermalDiffusion]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[Functions]
+  # A function rather than a GenericConstantMaterial so the sweep can set it.
+  [./paint_k]
+    type = ConstantFunction
+    value = 1.
+  [../]
+[]
+
+[Materials]
+  [./Al2024]
+    type = Aluminum2024
+    temperature = temperature
+    block = 'cold_coupon hot_coupon'
+  [../]
+  [./paint]
+    type = GenericFunctionMaterial
+    prop_names = 'thermal_conductivity dthermal_conductivity/dtemperature'
+    prop_values = 'paint_k 0'
+    block = paint
+  [../]
+[]
+
+[BCs]
+  [./cold_side]
+    type = DirichletBC
+    variable = temperature
+    boundary = cold_side
+    value = 300.
+  [../]
+  [./hot_side]
+    type = DirichletBC
+    variable = temperature
+    boundary = hot_side
+    value = 450.
+  [../]
+[]
+
+[Postprocessors]
+  [./heat_flux]
+    type = SideFluxIntegral
+    variable = temperature
+    boundary = cold_side
+    diffusivity = thermal_conductivity
+  [../]
+[]
+
+[Executioner]
+  type = SteadySweep
+  sweep_file = coupon_stack_sweep.csv
+  summary_postprocessors = heat_flux
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  # The summary table is the output; per-point fields are not kept.
+  print_perf_log = true
+[]
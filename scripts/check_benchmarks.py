@@ -0,0 +1,103 @@
+#!/usr/bin/env python
+"""
+Compare the benchmark_results.csv written by the unit tests against a
+stored baseline.
+
+The unit executable times the materials and kernels and measures the
+accuracy of the property fits (MaterialBenchmarkTest, KernelBenchmarkTest,
+ThermalPropertyConsistencyTest), writing one row per result.  A timing fails
+when it is more than --time-tol slower than the baseline; an error measure
+fails when it grows by more than --error-tol (relative) beyond the baseline.
+Results missing from either side are reported but do not fail.
+
+Timings only mean something against a baseline from the same machine and
+build, so record one there first with --save:
+
+  ./scripts/check_benchmarks.py --run --save
+  ./scripts/check_benchmarks.py --run
+
+or "make benchmark" in unit/.
+"""
+
+from __future__ import print_function
+
+import argparse
+import csv
+import os
+import subprocess
+import sys
+
+from profile_problems import ROOT
+
+BASELINE = os.path.join(ROOT, 'unit', 'benchmarks', 'baseline.csv')
+
+
+def read_results(csv_file):
+    with open(csv_file) as f:
+        return dict(((row['suite'], row['name'], row['metric']), (row['kind'], float(row['value'])))
+                    for row in csv.DictReader(f))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('results', nargs='?', default='benchmark_results.csv',
+                        help='Results written by the unit tests')
+    parser.add_argument('--baseline', default=BASELINE, help='Stored baseline')
+    parser.add_argument('--run', action='store_true',
+                        help='Run the unit tests first, from the top of the repository')
+    parser.add_argument('--save', action='store_true',
+                        help='Store the results as the new baseline instead of comparing')
+    parser.add_argument('--time-tol', type=float, default=0.25,
+                        help='Allowed relative slowdown of a timing')
+    parser.add_argument('--error-tol', type=float, default=0.1,
+                        help='Allowed relative growth of an error measure')
+    options = parser.parse_args()
+
+    if options.run:
+        unit_dir = os.path.join(ROOT, 'unit')
+        if subprocess.call([os.path.join(unit_dir, 'run_tests')], cwd=ROOT) != 0:
+            print('FAILED: the unit tests failed')
+            return 1
+        if options.results == 'benchmark_results.csv':
+            options.results = os.path.join(ROOT, options.results)
+
+    if options.save:
+        with open(options.results) as f, open(options.baseline, 'w') as out:
+            out.write(f.read())
+        print('Saved %s as the baseline %s' % (options.results, options.baseline))
+        return 0
+
+    results = read_results(options.results)
+    baseline = read_results(options.baseline)
+
+    failed = []
+    print('%-60s %12s %12s %9s' % ('', 'baseline', 'result', 'change'))
+    for key in sorted(set(results) | set(baseline)):
+        label = '/'.join(key)
+        if key not in baseline or key not in results:
+            print('%-60s %s' % (label, 'new' if key not in baseline else 'missing'))
+            continue
+
+        kind, value = results[key]
+        base = baseline[key][1]
+        change = (value - base) / base if base else 0.
+        if kind == 'time':
+            bad = value > base * (1. + options.time_tol)
+        else:
+            # Error measures near roundoff are compared absolutely.
+            bad = value > base * (1. + options.error_tol) + 1e-12
+        if bad:
+            failed.append(label)
+        print('%-60s %12.4g %12.4g %+8.1f%%%s' % (label, base, value, 100. * change,
+                                                  '  <-- FAILED' if bad else ''))
+
+    if failed:
+        print('FAILED: %d of %d results regressed' % (len(failed), len(results)))
+        return 1
+    print('OK')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,66 @@
+#!/usr/bin/env python
+"""
+Compare the meshed-paint coupon stack with the ResistiveThermalInterface one.
+
+Runs problems/benchmarks/coupon_stack_meshed.i and coupon_stack_resistive.i,
+and checks that the heat flux through the stack and the coupon temperatures
+on either side of the paint agree to within --rtol.  Element counts and
+solve times are reported alongside.
+
+  ./scripts/compare_coating.py --executable ./phoenix-opt
+"""
+
+from __future__ import print_function
+
+import argparse
+import os
+import sys
+
+from profile_problems import ROOT, find_executable, profile_deck
+
+DECKS = ['coupon_stack_meshed', 'coupon_stack_resistive']
+COMPARED = ['heat_flux', 'cold_face_temperature', 'hot_face_temperature']
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--executable', default=find_executable(), help='Phoenix executable')
+    parser.add_argument('-n', '--n-procs', type=int, default=1, help='MPI ranks')
+    parser.add_argument('-t', '--n-threads', type=int, default=1, help='Threads per rank')
+    parser.add_argument('--mpiexec', default='mpiexec', help='MPI launcher')
+    parser.add_argument('--rtol', type=float, default=1e-2,
+                        help='Relative tolerance on the compared quantities')
+    options = parser.parse_args()
+    options.cli_args = []
+
+    if not options.executable:
+        parser.error('no Phoenix executable found; build one or pass --executable')
+    options.executable = os.path.abspath(options.executable)
+
+    results = {}
+    for name in DECKS:
+        deck = os.path.join(ROOT, 'problems', 'benchmarks', name + '.i')
+        results[name] = profile_deck(deck, options)['postprocessors']
+
+    meshed, resistive = [results[name] for name in DECKS]
+
+    print('%-24s %14s %14s %10s' % ('', 'meshed', 'resistive', 'rel. diff'))
+    passed = True
+    for key in COMPARED:
+        diff = abs(resistive[key] - meshed[key]) / max(abs(meshed[key]), 1e-300)
+        passed = passed and diff <= options.rtol
+        print('%-24s %14.6g %14.6g %10.2e' % (key, meshed[key], resistive[key], diff))
+    for key in ['elements', 'solve_time']:
+        print('%-24s %14.6g %14.6g' % (key, meshed[key], resistive[key]))
+
+    if not passed:
+        print('FAILED: the resistive interface differs from the meshed paint by more than %g'
+              % options.rtol)
+        return 1
+    print('OK')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,62 @@
+#!/usr/bin/env python
+"""
+Compare the [ConjugatePreconditioning] split with the hand-written one it
+replaced on the turbine benchmark.
+
+Runs problems/benchmarks/long_turbine.i twice: with the default split
+(AMG for the solid, ASM/ILU for the fluid, multiplicative coupling), and
+with the options of the old hand-written FSP block (additive coupling,
+AMG for both).  Reports the total linear iterations, the time in KSPSolve
+and the wall time of each.
+
+  ./scripts/compare_preconditioners.py --executable ./phoenix-opt
+"""
+
+from __future__ import print_function
+
+import argparse
+import os
+import sys
+
+from profile_problems import ROOT, find_executable, profile_deck
+
+DECK = os.path.join(ROOT, 'problems', 'benchmarks', 'long_turbine.i')
+
+HAND_WRITTEN = ['ConjugatePreconditioning/coupling=additive',
+                'ConjugatePreconditioning/fluid_petsc_options_iname=-pc_type -pc_hypre_type',
+                'ConjugatePreconditioning/fluid_petsc_options_value=hypre boomeramg']
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('deck', nargs='?', default=DECK, help='Input deck (default: long_turbine.i)')
+    parser.add_argument('--executable', default=find_executable(), help='Phoenix executable')
+    parser.add_argument('-n', '--n-procs', type=int, default=1, help='MPI ranks')
+    parser.add_argument('-t', '--n-threads', type=int, default=1, help='Threads per rank')
+    parser.add_argument('--mpiexec', default='mpiexec', help='MPI launcher')
+    options = parser.parse_args()
+
+    if not options.executable:
+        parser.error('no Phoenix executable found; build one or pass --executable')
+    options.executable = os.path.abspath(options.executable)
+    deck = os.path.abspath(options.deck)
+
+    options.cli_args = HAND_WRITTEN
+    hand_written = profile_deck(deck, options)
+    options.cli_args = []
+    conjugate = profile_deck(deck, options)
+
+    print('%-24s %14s %14s' % ('', 'hand-written', 'conjugate'))
+    print('%-24s %14d %14d' % ('linear iterations',
+                               hand_written['postprocessors']['total_linear_iterations'],
+                               conjugate['postprocessors']['total_linear_iterations']))
+    print('%-24s %14.4f %14.4f' % ('KSPSolve (s)',
+                                   hand_written['phases']['linear_solve'],
+                                   conjugate['phases']['linear_solve']))
+    print('%-24s %14.4f %14.4f' % ('wall time (s)', hand_written['wall_time'], conjugate['wall_time']))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
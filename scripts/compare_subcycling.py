@@ -0,0 +1,75 @@
+#!/usr/bin/env python
+"""
+Compare the subcycled conjugate heat transfer run with the monolithic one.
+
+Runs problems/benchmarks/WAXTS_3mil_coating.i (fluid and solid in one
+solve, at the fluid time step) and problems/benchmarks/subcycled/
+WAXTS_3mil_coating_solid.i (the solid at its own time step, with the fluid
+subcycled in a sub-app) to the same end time, and reports the wall time of
+each and the relative difference in the average interface temperature.
+Adaptivity is switched off in the monolithic run, which the subcycled decks
+do not use.
+
+  ./scripts/compare_subcycling.py --executable ./phoenix-opt
+"""
+
+from __future__ import print_function
+
+import argparse
+import os
+import sys
+
+from profile_problems import ROOT, find_executable, profile_deck
+
+BENCHMARKS = os.path.join(ROOT, 'problems', 'benchmarks')
+MONOLITHIC = os.path.join(BENCHMARKS, 'WAXTS_3mil_coating.i')
+SUBCYCLED = os.path.join(BENCHMARKS, 'subcycled', 'WAXTS_3mil_coating_solid.i')
+SUBCYCLED_FLUID = os.path.join(BENCHMARKS, 'subcycled', 'WAXTS_3mil_coating_fluid.i')
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('--executable', default=find_executable(), help='Phoenix executable')
+    parser.add_argument('-n', '--n-procs', type=int, default=1, help='MPI ranks')
+    parser.add_argument('-t', '--n-threads', type=int, default=1, help='Threads per rank')
+    parser.add_argument('--mpiexec', default='mpiexec', help='MPI launcher')
+    parser.add_argument('--end-time', type=float, default=2e-5, help='Simulated time (s)')
+    parser.add_argument('--solid-dt', type=float, default=1e-5, help='Time step of the solid (s)')
+    parser.add_argument('--rtol', type=float, default=1e-3,
+                        help='Relative tolerance on the interface temperature')
+    options = parser.parse_args()
+
+    if not options.executable:
+        parser.error('no Phoenix executable found; build one or pass --executable')
+    options.executable = os.path.abspath(options.executable)
+
+    end_time = 'Executioner/end_time=%g' % options.end_time
+
+    options.cli_args = [end_time, 'Executioner/num_steps=1000000', 'Adaptivity/interval=1000000']
+    monolithic = profile_deck(MONOLITHIC, options)
+
+    # The sub-app input is given absolutely since the run is in a scratch directory.
+    options.cli_args = [end_time, 'Executioner/dt=%g' % options.solid_dt,
+                        'MultiApps/fluid/input_files=' + SUBCYCLED_FLUID]
+    subcycled = profile_deck(SUBCYCLED, options)
+
+    T_mono = monolithic['postprocessors']['interface_temperature']
+    T_sub = subcycled['postprocessors']['interface_temperature']
+    diff = abs(T_sub - T_mono) / abs(T_mono)
+
+    print('%-24s %14s %14s' % ('', 'monolithic', 'subcycled'))
+    print('%-24s %14.4f %14.4f' % ('wall time (s)', monolithic['wall_time'], subcycled['wall_time']))
+    print('%-24s %14.6f %14.6f' % ('interface T (K)', T_mono, T_sub))
+    print('relative difference in interface T: %.2e' % diff)
+    print('speedup: %.2f' % (monolithic['wall_time'] / subcycled['wall_time']))
+
+    if diff > options.rtol:
+        print('FAILED: the interface temperatures differ by more than %g' % options.rtol)
+        return 1
+    print('OK')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,208 @@
+#!/usr/bin/env python
+"""
+Profile the scaled-down problem decks in problems/benchmarks and write the
+per-phase timings to JSON.
+
+Each deck is run once with PETSc's -log_view and MOOSE's perf log.  The
+phases reported are
+
+  material_evaluation  ThermalMaterial::computeProperties
+  kernel_residual      Phoenix kernel residuals
+  kernel_jacobian      Phoenix kernel Jacobians
+  interface_kernels    Phoenix interface kernel residuals and Jacobians
+  adaptivity           Phoenix indicators and markers
+  residual             every residual evaluation (SNESFunctionEval)
+  jacobian             every Jacobian evaluation (SNESJacobianEval)
+  linear_solve         KSPSolve
+
+The first five come from the PhaseWallTime postprocessors in the decks and
+only cover Phoenix objects (summed over threads, slowest rank); the rest are
+PETSc events and cover the whole solve.  The raw PETSc events and perf log
+are kept alongside so that new phases can be pulled out of old results.
+
+  ./scripts/profile_problems.py --executable ./phoenix-opt -n 4 -o profile.json
+"""
+
+from __future__ import print_function
+
+import argparse
+import csv
+import datetime
+import glob
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), '..'))
+
+# PhaseWallTime postprocessor names in the decks, by JSON phase.
+POSTPROCESSOR_PHASES = {
+    'material_evaluation': ['material_time'],
+    'kernel_residual': ['kernel_residual_time'],
+    'kernel_jacobian': ['kernel_jacobian_time'],
+    'interface_kernels': ['interface_residual_time', 'interface_jacobian_time'],
+    'adaptivity': ['adaptivity_time'],
+}
+
+PETSC_PHASES = {
+    'residual': 'SNESFunctionEval',
+    'jacobian': 'SNESJacobianEval',
+    'linear_solve': 'KSPSolve',
+}
+
+# "SNESFunctionEval   46 1.0 6.2108e-01 1.0 ..." -> name, count, max time
+PETSC_EVENT = re.compile(r'^(\w+)\s+(\d+)\s+\d+\.\d+\s+(\d+\.\d+e[+-]\d+)\s')
+
+# "| compute_residual()   46   0.0042   0.0001   0.5012 ..." -> name, calls,
+# active time, average, total time
+PERF_LOG_EVENT = re.compile(
+    r'^\|\s+(\S.*?)\s+(\d+)\s+(\d+\.\d+)\s+(\d+\.\d+)\s+(\d+\.\d+)\s')
+PERF_LOG_HEADER = re.compile(r'^\|\s?(\S.*?)\s*\|?$')
+
+
+def find_executable():
+    for method in ['opt', 'oprof', 'devel', 'dbg']:
+        exe = os.path.join(ROOT, 'phoenix-' + method)
+        if os.path.exists(exe):
+            return exe
+    return None
+
+
+def git_commit():
+    try:
+        return subprocess.check_output(['git', 'rev-parse', 'HEAD'], cwd=ROOT).decode().strip()
+    except (OSError, subprocess.CalledProcessError):
+        return None
+
+
+def parse_petsc_log(output):
+    events = {}
+    for line in output.splitlines():
+        match = PETSC_EVENT.match(line)
+        if match:
+            events[match.group(1)] = {'count': int(match.group(2)),
+                                      'time': float(match.group(3))}
+    return events
+
+
+def parse_perf_log(output):
+    events = {}
+    category = ''
+    for line in output.splitlines():
+        match = PERF_LOG_EVENT.match(line)
+        if match:
+            name = (category + '/' if category else '') + match.group(1)
+            events[name] = {'calls': int(match.group(2)),
+                            'active_time': float(match.group(3)),
+                            'total_time': float(match.group(5))}
+            continue
+        # Category rows carry a name and nothing else.
+        match = PERF_LOG_HEADER.match(line)
+        if match and not re.search(r'\d|Event|---', match.group(1)):
+            category = match.group(1)
+    return events
+
+
+def read_postprocessors(csv_file):
+    if not os.path.exists(csv_file):
+        return {}
+    with open(csv_file) as f:
+        rows = list(csv.DictReader(f))
+    if not rows:
+        return {}
+    return dict((key, float(value)) for key, value in rows[-1].items())
+
+
+def profile_deck(deck, options):
+    name = os.path.splitext(os.path.basename(deck))[0]
+    work_dir = tempfile.mkdtemp(prefix='phoenix_profile_')
+    try:
+        command = [options.executable, '-i', deck, '--no-color',
+                   'Outputs/file_base=' + name, '-log_view']
+        if options.n_threads > 1:
+            command.append('--n-threads=%d' % options.n_threads)
+        if options.n_procs > 1:
+            command = [options.mpiexec, '-n', str(options.n_procs)] + command
+        command += options.cli_args
+
+        start = time.time()
+        process = subprocess.Popen(command, cwd=work_dir, stdout=subprocess.PIPE,
+                                   stderr=subprocess.STDOUT)
+        output = process.communicate()[0].decode('utf-8', 'replace')
+        wall_time = time.time() - start
+
+        if process.returncode != 0:
+            sys.stderr.write(output)
+            raise RuntimeError('%s failed with exit code %d' % (deck, process.returncode))
+
+        postprocessors = read_postprocessors(os.path.join(work_dir, name + '.csv'))
+        petsc_events = parse_petsc_log(output)
+        perf_log = parse_perf_log(output)
+    finally:
+        shutil.rmtree(work_dir, ignore_errors=True)
+
+    phases = {}
+    for phase, names in POSTPROCESSOR_PHASES.items():
+        phases[phase] = sum(postprocessors.get(n, 0.) for n in names)
+    for phase, event in PETSC_PHASES.items():
+        phases[phase] = petsc_events.get(event, {}).get('time', 0.)
+
+    result = {'deck': os.path.relpath(deck, ROOT),
+              'wall_time': wall_time,
+              'phases': phases,
+              'postprocessors': postprocessors,
+              'petsc_events': petsc_events,
+              'perf_log': perf_log}
+    # Callers that parse more of the log ask for the raw output.
+    if getattr(options, 'keep_output', False):
+        result['output'] = output
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('decks', nargs='*',
+                        default=sorted(glob.glob(os.path.join(ROOT, 'problems', 'benchmarks', '*.i'))),
+                        help='Input decks to profile (default: problems/benchmarks/*.i)')
+    parser.add_argument('--executable', default=find_executable(), help='Phoenix executable')
+    parser.add_argument('-n', '--n-procs', type=int, default=1, help='MPI ranks')
+    parser.add_argument('-t', '--n-threads', type=int, default=1, help='Threads per rank')
+    parser.add_argument('--mpiexec', default='mpiexec', help='MPI launcher')
+    parser.add_argument('-o', '--output', default='profile.json', help='JSON file to write')
+    parser.add_argument('--cli-args', nargs='*', default=[],
+                        help='Extra command line parameters, e.g. Mesh/nx=160')
+    options = parser.parse_args()
+
+    if not options.executable:
+        parser.error('no Phoenix executable found; build one or pass --executable')
+    options.executable = os.path.abspath(options.executable)
+
+    results = {'commit': git_commit(),
+               'date': datetime.datetime.utcnow().isoformat() + 'Z',
+               'executable': options.executable,
+               'n_procs': options.n_procs,
+               'n_threads': options.n_threads,
+               'cli_args': options.cli_args,
+               'decks': {}}
+
+    for deck in options.decks:
+        deck = os.path.abspath(deck)
+        name = os.path.splitext(os.path.basename(deck))[0]
+        print('Profiling %s ...' % name)
+        results['decks'][name] = profile_deck(deck, options)
+        for phase, seconds in sorted(results['decks'][name]['phases'].items()):
+            print('  %-20s %10.4f s' % (phase, seconds))
+
+    with open(options.output, 'w') as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+    print('Wrote ' + options.output)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,145 @@
+#!/usr/bin/env python
+"""
+Read the time series written by an InterfaceHeatFluxStream output, in either
+its csv or binary format.
+
+Prints the steps in the file with their interface-averaged heat flux terms,
+or converts the file to CSV:
+
+  ./scripts/read_interface_flux.py long_turbine_restart_interface_flux_samples.bin
+  ./scripts/read_interface_flux.py samples.bin --csv samples.csv
+
+or compares it with another such file, e.g. a gold, failing on a mismatch:
+
+  ./scripts/read_interface_flux.py samples.bin --diff gold/samples.csv
+
+From Python, read() returns the column names and a list of
+(time_step, time, rows) records with one list of values per row.
+"""
+
+from __future__ import print_function
+
+import argparse
+import csv
+import struct
+import sys
+
+MAGIC = b'PHXIFS01'
+
+FLUX_COLUMNS = ['fluid_conduction', 'solid_conduction', 'fluid_external',
+                'solid_external', 'radiation']
+
+
+def read_binary(path):
+    with open(path, 'rb') as f:
+        if f.read(len(MAGIC)) != MAGIC:
+            raise ValueError('%s is not an InterfaceHeatFluxStream file' % path)
+        n_columns, = struct.unpack('<I', f.read(4))
+        columns = []
+        for _ in range(n_columns):
+            length, = struct.unpack('<I', f.read(4))
+            columns.append(f.read(length).decode())
+
+        records = []
+        while True:
+            header = f.read(4 + 8 + 8)
+            if len(header) < 20:
+                break
+            time_step, time, n_rows = struct.unpack('<idQ', header)
+            values = struct.unpack('<%dd' % (n_rows * n_columns), f.read(8 * n_rows * n_columns))
+            rows = [list(values[r * n_columns:(r + 1) * n_columns]) for r in range(n_rows)]
+            records.append((time_step, time, rows))
+    return columns, records
+
+
+def read_csv(path):
+    with open(path) as f:
+        reader = csv.reader(f)
+        header = next(reader)
+        columns = header[2:]
+        records = []
+        for row in reader:
+            time_step, time = int(row[0]), float(row[1])
+            if not records or records[-1][0] != time_step:
+                records.append((time_step, time, []))
+            records[-1][2].append([float(v) for v in row[2:]])
+    return columns, records
+
+
+def read(path):
+    with open(path, 'rb') as f:
+        binary = f.read(len(MAGIC)) == MAGIC
+    return read_binary(path) if binary else read_csv(path)
+
+
+def diff(columns, records, gold_columns, gold_records, rel_err, abs_zero):
+    """The differences between two read() results, as messages."""
+    if columns != gold_columns:
+        return ['columns %s differ from the gold columns %s' % (columns, gold_columns)]
+    if [r[0] for r in records] != [r[0] for r in gold_records]:
+        return ['time steps %s differ from the gold time steps %s' %
+                ([r[0] for r in records], [r[0] for r in gold_records])]
+
+    def differs(value, gold):
+        if abs(value) < abs_zero and abs(gold) < abs_zero:
+            return False
+        return abs(value - gold) > rel_err * max(abs(value), abs(gold))
+
+    messages = []
+    for (time_step, time, rows), (_, gold_time, gold_rows) in zip(records, gold_records):
+        if differs(time, gold_time):
+            messages.append('step %d: time %.12g, gold %.12g' % (time_step, time, gold_time))
+        if len(rows) != len(gold_rows):
+            messages.append('step %d: %d rows, gold %d' % (time_step, len(rows), len(gold_rows)))
+            continue
+        for r, (row, gold_row) in enumerate(zip(rows, gold_rows)):
+            for column, value, gold in zip(columns, row, gold_row):
+                if differs(value, gold):
+                    messages.append('step %d row %d %s: %.12g, gold %.12g' %
+                                    (time_step, r, column, value, gold))
+    return messages
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('file', help='File written by InterfaceHeatFluxStream')
+    parser.add_argument('--csv', help='Write the samples to this CSV file instead of summarizing them')
+    parser.add_argument('--diff', help='Compare the samples with this file instead of summarizing them')
+    parser.add_argument('--rel-err', type=float, default=5.5e-6,
+                        help='Allowed relative difference from the --diff file')
+    parser.add_argument('--abs-zero', type=float, default=1e-11,
+                        help='Values below this are taken as zero by --diff')
+    options = parser.parse_args()
+
+    columns, records = read(options.file)
+
+    if options.diff:
+        gold_columns, gold_records = read(options.diff)
+        messages = diff(columns, records, gold_columns, gold_records,
+                        options.rel_err, options.abs_zero)
+        for message in messages:
+            print(message)
+        print('%s %s %s' % (options.file, 'differs from' if messages else 'matches', options.diff))
+        return 1 if messages else 0
+
+    if options.csv:
+        with open(options.csv, 'w') as f:
+            writer = csv.writer(f)
+            writer.writerow(['time_step', 'time'] + columns)
+            for time_step, time, rows in records:
+                for row in rows:
+                    writer.writerow([time_step, time] + row)
+        print('Wrote ' + options.csv)
+        return 0
+
+    index = [columns.index(c) for c in FLUX_COLUMNS]
+    print('%9s %14s %7s' % ('time_step', 'time', 'qps') + ''.join(' %17s' % c for c in FLUX_COLUMNS))
+    for time_step, time, rows in records:
+        means = [sum(row[i] for row in rows) / max(len(rows), 1) for i in index]
+        print('%9d %14.6g %7d' % (time_step, time, len(rows)) + ''.join(' %17.6g' % m for m in means))
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,112 @@
+#!/usr/bin/env python
+"""
+Strong scaling of the coupon stack and turbine benchmarks across mixes of
+MPI ranks and threads per rank.
+
+For every core count each decomposition ranks x threads = cores is run with
+profile_problems.profile_deck, from pure MPI down to --max-threads threads
+per rank.  The speedup and parallel efficiency of each run are taken against
+the single-core run of the same deck.  The per-phase times of the Phoenix
+objects are summed over threads by PhaseWallTime, so they are divided by the
+thread count to give a time per core comparable with the PETSc phases.
+
+Enlarge the decks for meaningful numbers on many cores, e.g.
+
+  ./scripts/scaling_study.py --executable ./phoenix-opt --cores 1 2 4 8 16 \\
+      --max-threads 8 --cli-args Mesh/uniform_refine=2 -o scaling.json
+"""
+
+from __future__ import print_function
+
+import argparse
+import copy
+import datetime
+import json
+import os
+
+from profile_problems import (POSTPROCESSOR_PHASES, ROOT, find_executable,
+                              git_commit, profile_deck)
+
+DECKS = [os.path.join(ROOT, 'problems', 'benchmarks', name)
+         for name in ['coupon_stack_meshed.i', 'coupon_stack_resistive.i', 'long_turbine.i']]
+
+
+def decompositions(cores, max_threads):
+    """(ranks, threads) pairs using exactly cores, pure MPI first."""
+    mixes = []
+    threads = 1
+    while threads <= min(cores, max_threads):
+        if cores % threads == 0:
+            mixes.append((cores // threads, threads))
+        threads *= 2
+    return mixes
+
+
+def run(deck, ranks, threads, options):
+    run_options = copy.copy(options)
+    run_options.n_procs = ranks
+    run_options.n_threads = threads
+    result = profile_deck(deck, run_options)
+
+    for phase in POSTPROCESSOR_PHASES:
+        result['phases'][phase] /= threads
+    result['n_procs'] = ranks
+    result['n_threads'] = threads
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('decks', nargs='*', default=DECKS,
+                        help='Input decks (default: the coupon stack and turbine benchmarks)')
+    parser.add_argument('--executable', default=find_executable(), help='Phoenix executable')
+    parser.add_argument('--cores', type=int, nargs='+', default=[1, 2, 4, 8],
+                        help='Total core counts (ranks x threads) to run')
+    parser.add_argument('--max-threads', type=int, default=8, help='Most threads per rank')
+    parser.add_argument('--mpiexec', default='mpiexec', help='MPI launcher')
+    parser.add_argument('-o', '--output', default='scaling.json', help='JSON file to write')
+    parser.add_argument('--cli-args', nargs='*', default=[],
+                        help='Extra command line parameters, e.g. Mesh/uniform_refine=2')
+    options = parser.parse_args()
+
+    if not options.executable:
+        parser.error('no Phoenix executable found; build one or pass --executable')
+    options.executable = os.path.abspath(options.executable)
+
+    cores = sorted(set([1] + options.cores))
+
+    results = {'commit': git_commit(),
+               'date': datetime.datetime.utcnow().isoformat() + 'Z',
+               'executable': options.executable,
+               'cli_args': options.cli_args,
+               'decks': {}}
+
+    for deck in options.decks:
+        deck = os.path.abspath(deck)
+        name = os.path.splitext(os.path.basename(deck))[0]
+        print('%s' % name)
+        print('  %5s %7s %7s %10s %8s %10s' % ('cores', 'ranks', 'threads', 'wall (s)', 'speedup', 'efficiency'))
+
+        runs = []
+        serial_time = None
+        for n in cores:
+            for ranks, threads in decompositions(n, options.max_threads):
+                result = run(deck, ranks, threads, options)
+                if serial_time is None:
+                    serial_time = result['wall_time']
+                result['speedup'] = serial_time / result['wall_time']
+                result['efficiency'] = result['speedup'] / n
+                runs.append(result)
+                print('  %5d %7d %7d %10.3f %8.2f %10.2f' % (n, ranks, threads, result['wall_time'],
+                                                           result['speedup'], result['efficiency']))
+
+        results['decks'][name] = runs
+
+    with open(options.output, 'w') as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+    print('Wrote ' + options.output)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,140 @@
+#!/usr/bin/env python
+"""
+Run a coupon stack parameter sweep with SteadySweep and collect one table.
+
+The sweep file (default problems/thermal_conductivity/coupon_stack_sweep.csv)
+is split into --jobs contiguous chunks, each solved by one run of
+coupon_stack_sweep.i on --n-procs ranks and --n-threads threads, all jobs at
+once.  The per-job summaries are merged in sweep order into --output.
+Neighbouring rows warm-start each other, so keep similar points together.
+
+With --compare N the first N points are also run as separate launches, one
+per point, and the time per point of both is reported.
+
+  ./scripts/sweep_coupon_stack.py --executable ./phoenix-opt --jobs 4 -o sweep.csv
+"""
+
+from __future__ import print_function
+
+import argparse
+import csv
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+from profile_problems import ROOT, find_executable
+
+DECK = os.path.join(ROOT, 'problems', 'thermal_conductivity', 'coupon_stack_sweep.i')
+SWEEP = os.path.join(ROOT, 'problems', 'thermal_conductivity', 'coupon_stack_sweep.csv')
+
+
+def read_sweep(sweep_file):
+    """The header line and data rows of a sweep file, without comments."""
+    with open(sweep_file) as f:
+        lines = [line.split('#')[0].strip() for line in f]
+    lines = [line for line in lines if line]
+    return lines[0], lines[1:]
+
+
+def start_job(options, work_dir, header, rows):
+    sweep_file = os.path.join(work_dir, 'sweep.csv')
+    with open(sweep_file, 'w') as f:
+        f.write('\n'.join([header] + rows) + '\n')
+
+    command = [options.executable, '-i', options.deck, '--no-color',
+               'Executioner/sweep_file=' + sweep_file, 'Outputs/file_base=job']
+    if options.n_threads > 1:
+        command.append('--n-threads=%d' % options.n_threads)
+    if options.n_procs > 1:
+        command = [options.mpiexec, '-n', str(options.n_procs)] + command
+    command += options.cli_args
+
+    log = open(os.path.join(work_dir, 'log.txt'), 'w')
+    return subprocess.Popen(command, cwd=work_dir, stdout=log, stderr=subprocess.STDOUT)
+
+
+def run_jobs(options, header, chunks):
+    """Run one job per chunk of rows at once; return each job's summary rows."""
+    work_dirs = [tempfile.mkdtemp(prefix='phoenix_sweep_') for _ in chunks]
+    try:
+        processes = [start_job(options, work_dir, header, rows)
+                     for work_dir, rows in zip(work_dirs, chunks)]
+        results = []
+        for work_dir, process in zip(work_dirs, processes):
+            if process.wait() != 0:
+                with open(os.path.join(work_dir, 'log.txt')) as f:
+                    sys.stderr.write(f.read())
+                raise RuntimeError('sweep job failed with exit code %d' % process.returncode)
+            with open(os.path.join(work_dir, 'job_sweep.csv')) as f:
+                results.append(list(csv.DictReader(f)))
+        return results
+    finally:
+        for work_dir in work_dirs:
+            shutil.rmtree(work_dir, ignore_errors=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('sweep', nargs='?', default=SWEEP, help='Sweep file')
+    parser.add_argument('--executable', default=find_executable(), help='Phoenix executable')
+    parser.add_argument('--deck', default=DECK, help='SteadySweep input deck')
+    parser.add_argument('-j', '--jobs', type=int, default=1, help='Concurrent sweep runs')
+    parser.add_argument('-n', '--n-procs', type=int, default=1, help='MPI ranks per run')
+    parser.add_argument('-t', '--n-threads', type=int, default=1, help='Threads per rank')
+    parser.add_argument('--mpiexec', default='mpiexec', help='MPI launcher')
+    parser.add_argument('--compare', type=int, default=0, metavar='N',
+                        help='Also time the first N points as separate runs')
+    parser.add_argument('-o', '--output', default='coupon_stack_sweep.csv',
+                        help='Merged summary table')
+    parser.add_argument('cli_args', nargs=argparse.REMAINDER,
+                        help='Extra command line arguments for every run, after --')
+    options = parser.parse_args()
+    options.cli_args = [arg for arg in options.cli_args if arg != '--']
+
+    if not options.executable:
+        parser.error('no Phoenix executable found; build one or pass --executable')
+    options.executable = os.path.abspath(options.executable)
+    options.deck = os.path.abspath(options.deck)
+
+    header, rows = read_sweep(options.sweep)
+    jobs = max(1, min(options.jobs, len(rows)))
+    size = (len(rows) + jobs - 1) // jobs
+    chunks = [rows[i:i + size] for i in range(0, len(rows), size)]
+
+    start = time.time()
+    results = run_jobs(options, header, chunks)
+    sweep_time = time.time() - start
+
+    # Renumber the points across jobs.
+    merged = []
+    for result in results:
+        for row in result:
+            row['point'] = str(len(merged))
+            merged.append(row)
+    with open(options.output, 'w') as f:
+        writer = csv.DictWriter(f, fieldnames=list(results[0][0].keys()), lineterminator='\n')
+        writer.writeheader()
+        writer.writerows(merged)
+
+    failed = sum(1 for row in merged if row['converged'] != '1')
+    print('%d points in %.2f s (%.3f s per point), %d did not converge; table in %s'
+          % (len(merged), sweep_time, sweep_time / len(merged), failed, options.output))
+
+    if options.compare > 0:
+        separate = [[row] for row in rows[:options.compare]]
+        start = time.time()
+        for chunk in separate:
+            run_jobs(options, header, [chunk])
+        separate_time = (time.time() - start) / len(separate)
+        print('separate runs: %.3f s per point, %.1fx slower than the sweep'
+              % (separate_time, separate_time * len(merged) / sweep_time))
+
+    return 1 if failed else 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,115 @@
+#!/usr/bin/env python
+"""
+Weak scaling of the conjugate heat transfer benchmarks on a distributed mesh:
+per-rank memory and setup time against the number of ranks.
+
+Each level of uniform refinement quadruples the elements of the 2D decks, so
+level k is run on 4^k ranks to hold the elements per rank fixed.  Every run
+uses Mesh/parallel_type=DISTRIBUTED unless --mesh replicated is given, so the
+two can be compared:
+
+  ./scripts/weak_scaling.py --executable ./phoenix-opt --levels 0 1 2 3 -o weak.json
+  ./scripts/weak_scaling.py --executable ./phoenix-opt --mesh replicated -o weak_replicated.json
+
+The memory is PETSc's -memory_view high-water mark of the process memory
+(largest rank and mean over ranks); the setup time is the Setup section of
+the MOOSE perf log, which covers reading, building and partitioning the mesh
+and setting up the problem.
+"""
+
+from __future__ import print_function
+
+import argparse
+import copy
+import datetime
+import json
+import os
+import re
+
+from profile_problems import ROOT, find_executable, git_commit, profile_deck
+
+DECKS = [os.path.join(ROOT, 'problems', 'benchmarks', name)
+         for name in ['coupon_stack_meshed.i', 'long_turbine.i']]
+
+# "Maximum (over computational time) process memory:  total 1.2e+08 max 3.1e+07 min 2.9e+07"
+PROCESS_MEMORY = re.compile(r'Maximum \(over computational time\) process memory:\s+'
+                            r'total\s+(\S+)\s+max\s+(\S+)\s+min\s+(\S+)')
+
+
+def setup_time(perf_log):
+    return sum(event['total_time'] for name, event in perf_log.items()
+               if name.split('/')[0].strip() == 'Setup')
+
+
+def run(deck, level, options):
+    ranks = 4 ** level
+    run_options = copy.copy(options)
+    run_options.n_procs = ranks
+    run_options.n_threads = 1
+    run_options.cli_args = options.cli_args + ['Mesh/parallel_type=' + options.mesh.upper(),
+                                               'Mesh/uniform_refine=%d' % level,
+                                               '-memory_view']
+    result = profile_deck(deck, run_options)
+
+    memory = PROCESS_MEMORY.search(result.pop('output', ''))
+    if memory:
+        result['memory_total'] = float(memory.group(1))
+        result['memory_max_rank'] = float(memory.group(2))
+        result['memory_mean_rank'] = float(memory.group(1)) / ranks
+    result['setup_time'] = setup_time(result['perf_log'])
+    result['n_procs'] = ranks
+    result['level'] = level
+    return result
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__,
+                                     formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument('decks', nargs='*', default=DECKS,
+                        help='Input decks (default: the coupon stack and turbine benchmarks)')
+    parser.add_argument('--executable', default=find_executable(), help='Phoenix executable')
+    parser.add_argument('--levels', type=int, nargs='+', default=[0, 1, 2],
+                        help='Uniform refinement levels; level k runs on 4^k ranks')
+    parser.add_argument('--mesh', choices=['distributed', 'replicated'], default='distributed',
+                        help='Mesh parallel type')
+    parser.add_argument('--mpiexec', default='mpiexec', help='MPI launcher')
+    parser.add_argument('-o', '--output', default='weak_scaling.json', help='JSON file to write')
+    parser.add_argument('--cli-args', nargs='*', default=[],
+                        help='Extra command line parameters, e.g. Executioner/num_steps=2')
+    options = parser.parse_args()
+
+    if not options.executable:
+        parser.error('no Phoenix executable found; build one or pass --executable')
+    options.executable = os.path.abspath(options.executable)
+    options.keep_output = True
+
+    results = {'commit': git_commit(),
+               'date': datetime.datetime.utcnow().isoformat() + 'Z',
+               'executable': options.executable,
+               'mesh': options.mesh,
+               'cli_args': options.cli_args,
+               'decks': {}}
+
+    for deck in options.decks:
+        deck = os.path.abspath(deck)
+        name = os.path.splitext(os.path.basename(deck))[0]
+        print('%s (%s mesh)' % (name, options.mesh))
+        print('  %5s %6s %16s %16s %10s %10s' % ('ranks', 'level', 'max rank (MB)', 'mean rank (MB)',
+                                                  'setup (s)', 'wall (s)'))
+        runs = []
+        for level in sorted(options.levels):
+            result = run(deck, level, options)
+            runs.append(result)
+            print('  %5d %6d %16.1f %16.1f %10.3f %10.3f' % (result['n_procs'], level,
+                                                            result.get('memory_max_rank', 0.) / 2**20,
+                                                            result.get('memory_mean_rank', 0.) / 2**20,
+                                                            result['setup_time'], result['wall_time']))
+        results['decks'][name] = runs
+
+    with open(options.output, 'w') as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+    print('Wrote ' + options.output)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,83 @@
+# A solid block (x < 0.5) and a "fluid" block, each a diffusion problem,
+# coupled across a resistive layer.  ConjugatePreconditioning splits
+# solid_temperature from rho, the default fluid variable.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 8
+  ny = 4
+  block_id = '0 1'
+  block_name = 'solid fluid'
+[]
+
+[MeshModifiers]
+  [./fluid]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.5 0 0'
+    top_right = '1 1 0'
+  [../]
+  [./interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = fluid
+    master_block = solid
+    paired_block = fluid
+    new_boundary = interface
+  [../]
+[]
+
+[Variables]
+  [./solid_temperature]
+    block = solid
+  [../]
+  [./rho]
+    block = fluid
+  [../]
+[]
+
+[Kernels]
+  [./solid_diffusion]
+    type = Diffusion
+    variable = solid_temperature
+  [../]
+  [./fluid_diffusion]
+    type = Diffusion
+    variable = rho
+  [../]
+[]
+
+[InterfaceKernels]
+  [./layer]
+    type = ResistiveThermalInterface
+    variable = solid_temperature
+    neighbor_var = rho
+    boundary = interface
+    thickness = 1e-3
+    conductivity = 0.5
+  [../]
+[]
+
+[BCs]
+  [./left]
+    type = DirichletBC
+    variable = solid_temperature
+    boundary = left
+    value = 400
+  [../]
+  [./right]
+    type = DirichletBC
+    variable = rho
+    boundary = right
+    value = 300
+  [../]
+[]
+
+[ConjugatePreconditioning]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  nl_rel_tol = 1e-10
+[]
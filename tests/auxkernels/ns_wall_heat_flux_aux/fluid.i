@@ -0,0 +1,106 @@
+# The fluid sub-app of ns_wall_heat_flux_aux.i.  Nothing is solved: the
+# density and total energy of a fluid at rest with a known temperature are
+# set at the start of each step, and NSWallHeatFluxAux computes the wall
+# heat flux from them at the end.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+  block_id = '0 1'
+  block_name = 'fluid solid'
+[]
+
+[MeshModifiers]
+  [./solid]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0 0.5 0'
+    top_right = '1 1 0'
+  [../]
+  [./wall]
+    type = SideSetsBetweenSubdomains
+    depends_on = solid
+    master_block = fluid
+    paired_block = solid
+    new_boundary = wall
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [./u]
+    block = fluid
+  [../]
+[]
+
+[AuxVariables]
+  [./rho]
+  [../]
+  [./rhoE]
+  [../]
+  [./wall_heat_flux]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[Kernels]
+  [./diffusion]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./rho]
+    type = FunctionAux
+    variable = rho
+    function = 1.2
+    execute_on = 'initial timestep_begin'
+  [../]
+  # rho cv T, with cv = R / (gamma - 1) = 717.5
+  [./rhoE]
+    type = FunctionAux
+    variable = rhoE
+    function = '1.2 * 717.5 * (300 + 100 * t * y * (1 + x))'
+    execute_on = 'initial timestep_begin'
+  [../]
+  [./wall_heat_flux]
+    type = NSWallHeatFluxAux
+    variable = wall_heat_flux
+    boundary = wall
+    rho = rho
+    rhoE = rhoE
+    fluid_properties = ideal_gas
+    execute_on = timestep_end
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./ideal_gas]
+      type = IdealGasFluidProperties
+      gamma = 1.4
+      R = 287
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./fluid]
+    type = GenericConstantMaterial
+    block = fluid
+    prop_names = thermal_conductivity
+    prop_values = 2
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 0.25
+[]
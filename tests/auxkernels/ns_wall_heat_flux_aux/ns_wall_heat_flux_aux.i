@@ -0,0 +1,119 @@
+# The wall heat flux of a fluid sub-app (fluid.i), subcycled at a quarter
+# of the step and transferred to the solid as in
+# problems/benchmarks/subcycled/WAXTS_3mil_coating_solid.i.  The fluid is at
+# rest, with T = 300 + 100 t y (1 + x) and k = 2, so the flux into the wall
+# at y = 0.5 is -200 t (1 + x).  Each solid wall element must take the mean
+# of it over its own side, and the total, -300 t, must be conserved.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+  block_id = '0 1'
+  block_name = 'fluid solid'
+[]
+
+[MeshModifiers]
+  [./solid]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0 0.5 0'
+    top_right = '1 1 0'
+  [../]
+  [./solid_wall]
+    type = SideSetsBetweenSubdomains
+    depends_on = solid
+    master_block = solid
+    paired_block = fluid
+    new_boundary = solid_wall
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [./u]
+    block = solid
+  [../]
+[]
+
+[AuxVariables]
+  [./fluid_heat_flux]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[Kernels]
+  [./diffusion]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[MultiApps]
+  [./fluid]
+    type = TransientMultiApp
+    app_type = PhoenixApp
+    input_files = fluid.i
+    execute_on = timestep_begin
+    sub_cycling = true
+    positions = '0 0 0'
+  [../]
+[]
+
+[Transfers]
+  [./wall_heat_flux]
+    type = MultiAppNearestNodeTransfer
+    direction = from_multiapp
+    multi_app = fluid
+    source_variable = wall_heat_flux
+    variable = fluid_heat_flux
+    source_boundary = wall
+    target_boundary = solid_wall
+    execute_on = timestep_begin
+    fixed_meshes = true
+  [../]
+[]
+
+# The solid elements along the wall, from left to right.
+[Postprocessors]
+  [./flux_0]
+    type = ElementalVariableValue
+    variable = fluid_heat_flux
+    elementid = 8
+  [../]
+  [./flux_1]
+    type = ElementalVariableValue
+    variable = fluid_heat_flux
+    elementid = 9
+  [../]
+  [./flux_2]
+    type = ElementalVariableValue
+    variable = fluid_heat_flux
+    elementid = 10
+  [../]
+  [./flux_3]
+    type = ElementalVariableValue
+    variable = fluid_heat_flux
+    elementid = 11
+  [../]
+  [./total]
+    type = SideIntegralVariablePostprocessor
+    variable = fluid_heat_flux
+    boundary = solid_wall
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+  num_steps = 2
+[]
+
+[Outputs]
+  csv = true
+[]
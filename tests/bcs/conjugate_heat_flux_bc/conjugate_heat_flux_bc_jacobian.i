@@ -0,0 +1,75 @@
+# Checks the ConjugateHeatFluxBC Jacobian against finite differences.  The
+# transferred fluid heat flux is stood in for by an AuxVariable.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 3
+  ny = 3
+[]
+
+[Variables]
+  [./temperature]
+  [../]
+[]
+
+[AuxVariables]
+  [./fluid_heat_flux]
+    initial_condition = 2000.
+  [../]
+[]
+
+[ICs]
+  [./temperature]
+    type = FunctionIC
+    variable = temperature
+    function = '300 + 200 * x + 20 * y'
+  [../]
+[]
+
+[Functions]
+  [./heating]
+    type = ParsedVectorFunction
+    value_x = '-1e4 * y'
+    value_y = 0
+    value_z = 0
+  [../]
+[]
+
+[Kernels]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[BCs]
+  [./fluid]
+    type = ConjugateHeatFluxBC
+    variable = temperature
+    boundary = right
+    heat_flux = fluid_heat_flux
+    heat_flux_func = heating
+    radiation_temp = 250.
+  [../]
+[]
+
+[Materials]
+  [./material]
+    type = TabulatedThermalMaterial
+    temperature = temperature
+    property_file = emissivity.csv
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
@@ -0,0 +1,113 @@
+# Checks the NSThermalMatchBC Jacobian, including its density and momentum
+# coupling, against finite differences.  Every variable simply diffuses.
+
+[GlobalParams]
+  family = LAGRANGE
+  order = FIRST
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 3
+  ny = 3
+[]
+
+[Variables]
+  [./rho]
+  [../]
+  [./rhou]
+  [../]
+  [./rhov]
+  [../]
+  [./rhoE]
+  [../]
+  [./solid_temperature]
+  [../]
+[]
+
+[ICs]
+  [./rho]
+    type = FunctionIC
+    variable = rho
+    function = '1.2 + 0.1 * x'
+  [../]
+  [./rhou]
+    type = FunctionIC
+    variable = rhou
+    function = '3 * y'
+  [../]
+  [./rhov]
+    type = FunctionIC
+    variable = rhov
+    function = '-2 * x'
+  [../]
+  [./rhoE]
+    type = FunctionIC
+    variable = rhoE
+    function = '2.6e5 + 1e4 * x * y'
+  [../]
+  [./solid_temperature]
+    type = FunctionIC
+    variable = solid_temperature
+    function = '310 + 15 * y'
+  [../]
+[]
+
+[Kernels]
+  [./rho]
+    type = Diffusion
+    variable = rho
+  [../]
+  [./rhou]
+    type = Diffusion
+    variable = rhou
+  [../]
+  [./rhov]
+    type = Diffusion
+    variable = rhov
+  [../]
+  [./rhoE]
+    type = Diffusion
+    variable = rhoE
+  [../]
+  [./solid_temperature]
+    type = Diffusion
+    variable = solid_temperature
+  [../]
+[]
+
+[BCs]
+  [./match]
+    type = NSThermalMatchBC
+    variable = rhoE
+    v = solid_temperature
+    boundary = left
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    fluid_properties = ideal_gas
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./ideal_gas]
+      type = IdealGasFluidProperties
+      gamma = 1.4
+      R = 287
+    [../]
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
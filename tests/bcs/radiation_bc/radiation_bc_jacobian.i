@@ -0,0 +1,58 @@
+# Checks the RadiationBC Jacobian, including the d(epsilon)/dT term, against
+# finite differences.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 3
+  ny = 3
+[]
+
+[Variables]
+  [./temperature]
+  [../]
+[]
+
+[ICs]
+  [./temperature]
+    type = FunctionIC
+    variable = temperature
+    function = '300 + 200 * x + 20 * y'
+  [../]
+[]
+
+[Kernels]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[BCs]
+  [./radiation]
+    type = RadiationBC
+    variable = temperature
+    boundary = right
+    ambient_temp = 250.
+  [../]
+[]
+
+[Materials]
+  [./material]
+    type = TabulatedThermalMaterial
+    temperature = temperature
+    property_file = emissivity.csv
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
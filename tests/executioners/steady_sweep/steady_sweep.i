@@ -0,0 +1,106 @@
+# A coarse coupon stack, as in problems/thermal_conductivity/coupon_stack.i,
+# swept over the paint conductivity and the side temperatures.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  xmax = 0.0132588
+  ymax = 0.0254
+  nx = 29
+  ny = 10
+  block_id = '0 1 2'
+  block_name = 'cold_coupon paint hot_coupon'
+[]
+
+[MeshModifiers]
+  [./paint]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.0064008 0 0'
+    top_right = '0.006858 0.0254 0'
+  [../]
+  [./hot_coupon]
+    type = SubdomainBoundingBox
+    depends_on = paint
+    block_id = 2
+    bottom_left = '0.006858 0 0'
+    top_right = '0.0132588 0.0254 0'
+  [../]
+[]
+
+[Variables]
+  [./temperature]
+    initial_condition = 300.
+  [../]
+[]
+
+[Kernels]
+  [./ThermalDiffusion]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[Functions]
+  [./paint_k]
+    type = ConstantFunction
+    value = 1.
+  [../]
+[]
+
+[Materials]
+  [./Al2024]
+    type = Aluminum2024
+    temperature = temperature
+    block = 'cold_coupon hot_coupon'
+  [../]
+  [./paint]
+    type = GenericFunctionMaterial
+    prop_names = 'thermal_conductivity dthermal_conductivity/dtemperature'
+    prop_values = 'paint_k 0'
+    block = paint
+  [../]
+[]
+
+[BCs]
+  [./cold_side]
+    type = DirichletBC
+    variable = temperature
+    boundary = left
+    value = 300.
+  [../]
+  [./hot_side]
+    type = DirichletBC
+    variable = temperature
+    boundary = right
+    value = 450.
+  [../]
+[]
+
+[Postprocessors]
+  [./heat_flux]
+    type = SideFluxIntegral
+    variable = temperature
+    boundary = left
+    diffusivity = thermal_conductivity
+  [../]
+[]
+
+[Executioner]
+  type = SteadySweep
+  sweep_file = steady_sweep.csv
+  summary_postprocessors = heat_flux
+  solve_type = NEWTON
+  # Solving each linear system well below the nonlinear tolerance keeps the
+  # iteration counts in the summary those of Newton's method itself.
+  nl_rel_tol = 1e-10
+  l_tol = 1e-10
+[]
+
+[Outputs]
+  # One row per point, without the initial condition.
+  [./csv]
+    type = CSV
+    execute_on = timestep_end
+  [../]
+[]
@@ -0,0 +1,103 @@
+# Projects source.i onto a finer mesh whose elements do not nest in the
+# source ones.  Linear fields are interpolated exactly, so the errors are
+# zero, and they are only zero on the interface nodes when each variable is
+# taken from its own block.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 12
+  ny = 6
+  block_id = '0 1'
+  block_name = 'fluid solid'
+[]
+
+[MeshModifiers]
+  [./solid]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.5 0 0'
+    top_right = '1 1 0'
+  [../]
+[]
+
+[Variables]
+  [./rho]
+    block = fluid
+  [../]
+  [./solid_temperature]
+    block = solid
+  [../]
+[]
+
+[UserObjects]
+  [./source]
+    type = SolutionProjection
+    file = source_out.e
+    variables = 'rho solid_temperature'
+  [../]
+[]
+
+[ICs]
+  [./rho]
+    type = ProjectedSolutionIC
+    variable = rho
+    solution_projection = source
+  [../]
+  [./solid_temperature]
+    type = ProjectedSolutionIC
+    variable = solid_temperature
+    solution_projection = source
+  [../]
+[]
+
+[Kernels]
+  [./rho_time]
+    type = TimeDerivative
+    variable = rho
+  [../]
+  [./solid_temperature_time]
+    type = TimeDerivative
+    variable = solid_temperature
+  [../]
+[]
+
+[Functions]
+  [./rho]
+    type = ParsedFunction
+    value = '1.2 + 0.4 * x - 0.2 * y'
+  [../]
+  [./solid_temperature]
+    type = ParsedFunction
+    value = '450 - 100 * x + 30 * y'
+  [../]
+[]
+
+[Postprocessors]
+  [./rho_error]
+    type = ElementL2Error
+    variable = rho
+    function = rho
+    block = fluid
+    execute_on = initial
+  [../]
+  [./solid_temperature_error]
+    type = ElementL2Error
+    variable = solid_temperature
+    function = solid_temperature
+    block = solid
+    execute_on = initial
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = initial
+  [../]
+[]
@@ -0,0 +1,63 @@
+# The solution projected by projected_solution_ic.i: linear fields on a
+# fluid block (x < 0.5) and a solid block (x > 0.5) that do not agree on
+# the interface.  The time derivatives keep them unchanged over the step.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 8
+  ny = 4
+  block_id = '0 1'
+  block_name = 'fluid solid'
+[]
+
+[MeshModifiers]
+  [./solid]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.5 0 0'
+    top_right = '1 1 0'
+  [../]
+[]
+
+[Variables]
+  [./rho]
+    block = fluid
+  [../]
+  [./solid_temperature]
+    block = solid
+  [../]
+[]
+
+[ICs]
+  [./rho]
+    type = FunctionIC
+    variable = rho
+    function = '1.2 + 0.4 * x - 0.2 * y'
+  [../]
+  [./solid_temperature]
+    type = FunctionIC
+    variable = solid_temperature
+    function = '450 - 100 * x + 30 * y'
+  [../]
+[]
+
+[Kernels]
+  [./rho_time]
+    type = TimeDerivative
+    variable = rho
+  [../]
+  [./solid_temperature_time]
+    type = TimeDerivative
+    variable = solid_temperature
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 1
+[]
+
+[Outputs]
+  exodus = true
+[]
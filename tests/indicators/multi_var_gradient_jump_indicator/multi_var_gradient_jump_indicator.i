@@ -0,0 +1,144 @@
+# Computes the gradient jumps of u, which lives everywhere, and v, which only
+# lives on the right block, in one MultiVarGradientJumpIndicator, and the
+# same with a VarRestrictedGradientJumpIndicator per variable.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 8
+  ny = 8
+  block_id = '0 1'
+  block_name = 'left right'
+[]
+
+[MeshModifiers]
+  [./right]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.5 0 0'
+    top_right = '1 1 0'
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+  [./v]
+    block = right
+  [../]
+[]
+
+[ICs]
+  [./u]
+    type = FunctionIC
+    variable = u
+    function = 'tanh(10 * (x + y - 1))'
+  [../]
+  [./v]
+    type = FunctionIC
+    variable = v
+    function = 'x * x * y'
+  [../]
+[]
+
+[Kernels]
+  [./u_diffusion]
+    type = Diffusion
+    variable = u
+  [../]
+  [./u_time]
+    type = TimeDerivative
+    variable = u
+  [../]
+  [./v_diffusion]
+    type = Diffusion
+    variable = v
+  [../]
+  [./v_time]
+    type = TimeDerivative
+    variable = v
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 1e-3
+  num_steps = 1
+[]
+
+[Adaptivity]
+  marker = none
+  [./Indicators]
+    [./fused]
+      type = MultiVarGradientJumpIndicator
+      variable = u
+      additional_variables = v
+      scaling = '1 10'
+      component_indicators = 'u_component v_component'
+    [../]
+    [./u_component]
+      type = GradientJumpComponentIndicator
+      variable = u
+    [../]
+    [./v_component]
+      type = GradientJumpComponentIndicator
+      variable = v
+    [../]
+    [./u_reference]
+      type = VarRestrictedGradientJumpIndicator
+      variable = u
+    [../]
+    [./v_reference]
+      type = VarRestrictedGradientJumpIndicator
+      variable = v
+    [../]
+  [../]
+  [./Markers]
+    [./none]
+      type = UniformMarker
+      mark = DO_NOTHING
+    [../]
+  [../]
+[]
+
+# The indicators are computed at the end of the step, after the
+# postprocessors of timestep_end, so they are compared at the end of the run.
+# The integrals pin the indicators themselves, including the weighting of
+# each side by its elements' hmax.
+[Postprocessors]
+  [./fused_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = fused
+    execute_on = final
+  [../]
+  [./u_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = u_reference
+    execute_on = final
+  [../]
+  [./v_integral]
+    type = ElementIntegralVariablePostprocessor
+    variable = v_reference
+    execute_on = final
+  [../]
+  [./u_difference]
+    type = ElementL2Difference
+    variable = u_component
+    other_variable = u_reference
+    execute_on = final
+  [../]
+  [./v_difference]
+    type = ElementL2Difference
+    variable = v_component
+    other_variable = v_reference
+    execute_on = final
+  [../]
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = final
+  [../]
+[]
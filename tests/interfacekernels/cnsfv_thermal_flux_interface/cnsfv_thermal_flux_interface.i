@@ -0,0 +1,260 @@
+# One finite volume fluid cell (x < 0.5) against one solid element across a
+# heat-conducting wall.  Only the interface acts on the fluid, so the
+# solution of each backward Euler step can be written down:
+#
+#   V (rhou - rhou_old) / dt = -p
+#   V (rhoe - rhoe_old) / dt = k_f / d (T_s - T_f)
+#   k_s (T_s - T_b) / L      = -k_f / d (T_s - T_f)
+#
+# with V = 0.5, d = 0.25 and L = 0.5.  The left end of the fluid is not a
+# wall, so the wall pressure accelerates it away from the solid and the
+# growing kinetic energy cools it.  The mass and y-momentum do not change.
+# The gold values come from solving these equations.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 2
+  block_id = '0 1'
+  block_name = 'fluid solid'
+[]
+
+[MeshModifiers]
+  [./solid]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.5 0 0'
+    top_right = '1 1 0'
+  [../]
+  [./interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = solid
+    master_block = fluid
+    paired_block = solid
+    new_boundary = interface
+  [../]
+[]
+
+[Variables]
+  [./rho]
+    family = MONOMIAL
+    order = CONSTANT
+    block = fluid
+    initial_condition = 1e-3
+  [../]
+  [./rhou]
+    family = MONOMIAL
+    order = CONSTANT
+    block = fluid
+    initial_condition = 0.05
+  [../]
+  [./rhov]
+    family = MONOMIAL
+    order = CONSTANT
+    block = fluid
+    initial_condition = 0.02
+  [../]
+  # 300 K, plus the kinetic energy.
+  [./rhoe]
+    family = MONOMIAL
+    order = CONSTANT
+    block = fluid
+    initial_condition = 216.7
+  [../]
+  [./solid_temperature]
+    block = solid
+    initial_condition = 1300
+  [../]
+[]
+
+[AuxVariables]
+  [./fluid_temperature]
+    family = MONOMIAL
+    order = CONSTANT
+    block = fluid
+  [../]
+[]
+
+[Kernels]
+  [./rho_time]
+    type = TimeDerivative
+    variable = rho
+  [../]
+  [./rhou_time]
+    type = TimeDerivative
+    variable = rhou
+  [../]
+  [./rhov_time]
+    type = TimeDerivative
+    variable = rhov
+  [../]
+  [./rhoe_time]
+    type = TimeDerivative
+    variable = rhoe
+  [../]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = solid_temperature
+  [../]
+[]
+
+[AuxKernels]
+  [./fluid_temperature]
+    type = CNSFVTempAux
+    variable = fluid_temperature
+    execute_on = timestep_end
+  [../]
+[]
+
+[InterfaceKernels]
+  [./mass]
+    type = CNSFVThermalFluxInterface
+    variable = rho
+    component = mass
+    neighbor_var = solid_temperature
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoe = rhoe
+    bc_uo = wall
+    fluid_properties = ideal_gas
+  [../]
+  [./x_momentum]
+    type = CNSFVThermalFluxInterface
+    variable = rhou
+    component = x-momentum
+    neighbor_var = solid_temperature
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoe = rhoe
+    bc_uo = wall
+    fluid_properties = ideal_gas
+  [../]
+  [./y_momentum]
+    type = CNSFVThermalFluxInterface
+    variable = rhov
+    component = y-momentum
+    neighbor_var = solid_temperature
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoe = rhoe
+    bc_uo = wall
+    fluid_properties = ideal_gas
+  [../]
+  [./total_energy]
+    type = CNSFVThermalFluxInterface
+    variable = rhoe
+    component = total-energy
+    neighbor_var = solid_temperature
+    boundary = interface
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoe = rhoe
+    bc_uo = wall
+    fluid_properties = ideal_gas
+  [../]
+[]
+
+[BCs]
+  [./solid_temperature]
+    type = DirichletBC
+    variable = solid_temperature
+    boundary = right
+    value = 1300
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./ideal_gas]
+      type = IdealGasFluidProperties
+      gamma = 1.4
+      R = 287
+      k = 2.5e-2
+    [../]
+  [../]
+[]
+
+# First order, so the wall state is the cell state.
+[UserObjects]
+  [./slope_limit]
+    type = CNSFVNoSlopeLimiting
+    execute_on = linear
+  [../]
+  [./wall]
+    type = CNSFVThermalBCUserObject
+    fluid_properties = ideal_gas
+    execute_on = linear
+  [../]
+[]
+
+[Materials]
+  [./fluid]
+    type = CNSFVMaterial
+    block = fluid
+    rho = rho
+    rhou = rhou
+    rhov = rhov
+    rhoe = rhoe
+    slope_limiting = slope_limit
+    fluid_properties = ideal_gas
+  [../]
+  [./solid]
+    type = GenericConstantMaterial
+    block = solid
+    prop_names = thermal_conductivity
+    prop_values = 10
+  [../]
+[]
+
+[Postprocessors]
+  [./rhou]
+    type = ElementalVariableValue
+    variable = rhou
+    elementid = 0
+  [../]
+  [./rhoe]
+    type = ElementalVariableValue
+    variable = rhoe
+    elementid = 0
+  [../]
+  [./fluid_temperature]
+    type = ElementalVariableValue
+    variable = fluid_temperature
+    elementid = 0
+  [../]
+  [./solid_temperature]
+    type = NodalVariableValue
+    variable = solid_temperature
+    nodeid = 1
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  num_steps = 2
+  dt = 1e-3
+  nl_rel_tol = 1e-12
+  nl_abs_tol = 1e-12
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = timestep_end
+  [../]
+[]
@@ -0,0 +1,160 @@
+# A fluid block (x < 0.5) and a solid block (x > 0.5) exchanging heat
+# through NSThermalFluxInterface.  The fluid equations are replaced by simple
+# diffusion so that only the interface kernel is being exercised.  The solid
+# conductivity and emissivity depend on its temperature, and the solid
+# temperature varies across the interface, so the Jacobian sees both
+# derivatives.
+
+[GlobalParams]
+  family = LAGRANGE
+  order = FIRST
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 8
+  ny = 4
+  block_id = '0 1'
+  block_name = 'fluid solid'
+[]
+
+[MeshModifiers]
+  [./solid]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.5 0 0'
+    top_right = '1 1 0'
+  [../]
+  [./interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = solid
+    master_block = fluid
+    paired_block = solid
+    new_boundary = interface
+  [../]
+[]
+
+[Variables]
+  [./rho]
+    block = fluid
+    initial_condition = 1.2
+  [../]
+  [./rhoE]
+    block = fluid
+  [../]
+  [./solid_temperature]
+    block = solid
+  [../]
+[]
+
+[ICs]
+  [./rhoE]
+    type = FunctionIC
+    variable = rhoE
+    function = '1.2 * 717.5 * (300 + 200 * x + 10 * y)'
+  [../]
+  [./solid_temperature]
+    type = FunctionIC
+    variable = solid_temperature
+    function = '450 + 100 * x - 20 * y'
+  [../]
+[]
+
+[Functions]
+  [./fluid_flux]
+    type = ParsedVectorFunction
+    value_x = 1e3*y
+    value_y = 0
+  [../]
+  [./solid_flux]
+    type = ParsedVectorFunction
+    value_x = -5e2
+    value_y = 2e2*x
+  [../]
+[]
+
+[Kernels]
+  [./rho_time]
+    type = TimeDerivative
+    variable = rho
+  [../]
+  [./rho_space]
+    type = Diffusion
+    variable = rho
+  [../]
+  [./rhoE_time]
+    type = TimeDerivative
+    variable = rhoE
+  [../]
+  [./rhoE_space]
+    type = Diffusion
+    variable = rhoE
+  [../]
+  [./thermal_time]
+    type = SpecificHeatConductionTimeDerivative
+    variable = solid_temperature
+  [../]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = solid_temperature
+  [../]
+[]
+
+[InterfaceKernels]
+  [./interface_flux]
+    type = NSThermalFluxInterface
+    variable = rhoE
+    neighbor_var = solid_temperature
+    boundary = interface
+    rho = rho
+    fluid_properties = ideal_gas
+    var_heat_flux_func = fluid_flux
+    neighbor_heat_flux_func = solid_flux
+    radiation_temp = 350
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./ideal_gas]
+      type = IdealGasFluidProperties
+      gamma = 1.4
+      R = 287
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./fluid]
+    type = GenericConstantMaterial
+    block = fluid
+    prop_names = 'thermal_conductivity epsilon'
+    prop_values = '2.57e-2 0.'
+  [../]
+  [./solid]
+    type = TabulatedThermalMaterial
+    block = solid
+    temperature = solid_temperature
+    property_file = solid.csv
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  num_steps = 3
+  dt = 1e-2
+  nl_rel_tol = 1e-10
+[]
+
+[Outputs]
+  exodus = true
+[]
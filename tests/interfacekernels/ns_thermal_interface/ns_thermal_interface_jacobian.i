@@ -0,0 +1,125 @@
+# Checks the NSThermalInterface Jacobian, including its density coupling,
+# against finite differences.  The fluid (x < 0.5) and solid (x > 0.5)
+# variables simply diffuse.
+
+[GlobalParams]
+  family = LAGRANGE
+  order = FIRST
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 2
+  block_id = '0 1'
+  block_name = 'fluid solid'
+[]
+
+[MeshModifiers]
+  [./solid]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.5 0 0'
+    top_right = '1 1 0'
+  [../]
+  [./interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = solid
+    master_block = fluid
+    paired_block = solid
+    new_boundary = interface
+  [../]
+[]
+
+[Variables]
+  [./rho]
+    block = fluid
+  [../]
+  [./rhoE]
+    block = fluid
+  [../]
+  [./solid_temperature]
+    block = solid
+  [../]
+[]
+
+[ICs]
+  [./rho]
+    type = FunctionIC
+    variable = rho
+    function = '1.2 + 0.2 * y'
+  [../]
+  [./rhoE]
+    type = FunctionIC
+    variable = rhoE
+    function = '1.2 * 717.5 * (300 + 40 * x + 10 * y)'
+  [../]
+  [./solid_temperature]
+    type = FunctionIC
+    variable = solid_temperature
+    function = '350 - 30 * y'
+  [../]
+[]
+
+[Kernels]
+  [./rho]
+    type = Diffusion
+    variable = rho
+  [../]
+  [./rhoE]
+    type = Diffusion
+    variable = rhoE
+  [../]
+  [./solid_temperature]
+    type = Diffusion
+    variable = solid_temperature
+  [../]
+[]
+
+[InterfaceKernels]
+  [./interface]
+    type = NSThermalInterface
+    variable = rhoE
+    neighbor_var = solid_temperature
+    boundary = interface
+    rho = rho
+    fluid_properties = ideal_gas
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./ideal_gas]
+      type = IdealGasFluidProperties
+      gamma = 1.4
+      R = 287
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./fluid]
+    type = GenericConstantMaterial
+    block = fluid
+    prop_names = 'thermal_conductivity'
+    prop_values = '2.57e-2'
+  [../]
+  [./solid]
+    type = Steatite
+    block = solid
+    temperature = solid_temperature
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
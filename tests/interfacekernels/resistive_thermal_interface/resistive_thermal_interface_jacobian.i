@@ -0,0 +1,81 @@
+# Checks the ResistiveThermalInterface Jacobian, including the temperature
+# dependence of the layer conductivity and thickness, against finite
+# differences.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 2
+[]
+
+[MeshModifiers]
+  [./right_block]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.5 0 0'
+    top_right = '1 1 0'
+  [../]
+  [./interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = right_block
+    master_block = 0
+    paired_block = 1
+    new_boundary = interface
+  [../]
+[]
+
+[Variables]
+  [./left_temperature]
+    block = 0
+  [../]
+  [./right_temperature]
+    block = 1
+  [../]
+[]
+
+[ICs]
+  [./left_temperature]
+    type = FunctionIC
+    variable = left_temperature
+    function = '400 + 20 * x + 10 * y'
+  [../]
+  [./right_temperature]
+    type = FunctionIC
+    variable = right_temperature
+    function = '300 + 40 * x - 10 * y * y'
+  [../]
+[]
+
+[Kernels]
+  [./left_diffusion]
+    type = Diffusion
+    variable = left_temperature
+  [../]
+  [./right_diffusion]
+    type = Diffusion
+    variable = right_temperature
+  [../]
+[]
+
+[InterfaceKernels]
+  [./layer]
+    type = ResistiveThermalInterface
+    variable = left_temperature
+    neighbor_var = right_temperature
+    boundary = interface
+    property_file = layer.csv
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
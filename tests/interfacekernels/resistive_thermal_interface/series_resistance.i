@@ -0,0 +1,142 @@
+# Steady conduction through two 1D blocks joined by an unmeshed layer of
+# resistance R = thickness / conductivity = 0.5.  With the blocks' own
+# resistances L / k = 1 / 2 and 1 / 4 in series, the flux is
+#   q = (500 - 300) / (0.5 + 0.5 + 0.25) = 160
+# and the layer carries a temperature jump of q R = 80, from 420 on the
+# left block to 340 on the right one.  Linear elements are exact here.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 4
+  xmax = 2
+[]
+
+[MeshModifiers]
+  [./right_block]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '1 0 0'
+    top_right = '2 0 0'
+  [../]
+  [./interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = right_block
+    master_block = 0
+    paired_block = 1
+    new_boundary = interface
+  [../]
+  [./right_interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = right_block
+    master_block = 1
+    paired_block = 0
+    new_boundary = right_interface
+  [../]
+[]
+
+[Variables]
+  [./left_temperature]
+    block = 0
+  [../]
+  [./right_temperature]
+    block = 1
+  [../]
+[]
+
+[Kernels]
+  [./left_conduction]
+    type = HeatConductionDMI
+    variable = left_temperature
+  [../]
+  [./right_conduction]
+    type = HeatConductionDMI
+    variable = right_temperature
+  [../]
+[]
+
+[InterfaceKernels]
+  [./layer]
+    type = ResistiveThermalInterface
+    variable = left_temperature
+    neighbor_var = right_temperature
+    boundary = interface
+    conductivity = 0.02
+    thickness = 0.01
+  [../]
+[]
+
+[Materials]
+  [./left]
+    type = GenericConstantMaterial
+    block = 0
+    prop_names = thermal_conductivity
+    prop_values = 2
+  [../]
+  [./right]
+    type = GenericConstantMaterial
+    block = 1
+    prop_names = thermal_conductivity
+    prop_values = 4
+  [../]
+[]
+
+[BCs]
+  [./hot]
+    type = DirichletBC
+    variable = left_temperature
+    boundary = left
+    value = 500
+  [../]
+  [./cold]
+    type = DirichletBC
+    variable = right_temperature
+    boundary = right
+    value = 300
+  [../]
+[]
+
+[Postprocessors]
+  # Out of the left block, through the layer.
+  [./interface_flux]
+    type = SideFluxIntegral
+    variable = left_temperature
+    boundary = interface
+    diffusivity = thermal_conductivity
+  [../]
+  [./left_interface_temperature]
+    type = SideAverageValue
+    variable = left_temperature
+    boundary = interface
+  [../]
+  [./right_interface_temperature]
+    type = SideAverageValue
+    variable = right_temperature
+    boundary = right_interface
+  [../]
+  [./temperature_jump]
+    type = DifferencePostprocessor
+    value1 = left_interface_temperature
+    value2 = right_interface_temperature
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+  nl_rel_tol = 1e-12
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = timestep_end
+  [../]
+[]
@@ -0,0 +1,49 @@
+# Checks the HeatConductionDMI Jacobian, including the dk/dT term, against
+# finite differences.  The temperatures stay inside one Aluminum2024
+# conductivity fit.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 3
+  ny = 3
+[]
+
+[Variables]
+  [./temperature]
+  [../]
+[]
+
+[ICs]
+  [./temperature]
+    type = FunctionIC
+    variable = temperature
+    function = '200 + 150 * x + 50 * y * y'
+  [../]
+[]
+
+[Kernels]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[Materials]
+  [./aluminum]
+    type = Aluminum2024
+    temperature = temperature
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
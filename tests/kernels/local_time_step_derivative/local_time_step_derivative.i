@@ -0,0 +1,79 @@
+# A steatite plate held at 300 K on the left and heated on the right, on a
+# mesh graded towards the heated edge.  With local time stepping and the SER
+# ramp it reaches steady state long before the physical end time.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 2
+  xmax = 0.01
+  ymax = 0.002
+  bias_x = 0.8
+[]
+
+[Variables]
+  [./temperature]
+    initial_condition = 300.
+  [../]
+[]
+
+[Kernels]
+  [./thermal_time]
+    type = SpecificHeatConductionTimeDerivative
+    variable = temperature
+  [../]
+  [./thermal_local_time]
+    type = LocalTimeStepDerivative
+    variable = temperature
+    density = density
+    specific_heat = specific_heat
+  [../]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[BCs]
+  [./cold]
+    type = DirichletBC
+    variable = temperature
+    boundary = left
+    value = 300.
+  [../]
+  [./heating]
+    type = NeumannBC
+    variable = temperature
+    boundary = right
+    value = 1e5
+  [../]
+[]
+
+[Materials]
+  [./steatite]
+    type = Steatite
+    temperature = temperature
+  [../]
+  [./local_time_step]
+    type = LocalTimeStepMaterial
+    cfl = cfl
+  [../]
+[]
+
+[Postprocessors]
+  [./cfl]
+    type = SERCFLNumber
+    cfl_initial = 10.
+    execute_on = 'initial timestep_end'
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 1.
+  end_time = 200.
+  trans_ss_check = true
+  ss_check_tol = 1e-8
+[]
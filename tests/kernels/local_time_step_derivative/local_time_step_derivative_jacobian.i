@@ -0,0 +1,76 @@
+# Checks the LocalTimeStepDerivative Jacobian against finite differences.
+# The preset boundary values move the state away from the old one, so
+# du/dt and the temperature dependence of rho cp are seen.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 3
+  ny = 3
+  xmax = 0.01
+  ymax = 0.01
+[]
+
+[Variables]
+  [./temperature]
+  [../]
+[]
+
+[ICs]
+  [./temperature]
+    type = FunctionIC
+    variable = temperature
+    function = '300 + 2e4 * x + 2e3 * y'
+  [../]
+[]
+
+[Kernels]
+  [./thermal_time]
+    type = SpecificHeatConductionTimeDerivative
+    variable = temperature
+  [../]
+  [./thermal_local_time]
+    type = LocalTimeStepDerivative
+    variable = temperature
+    density = density
+    specific_heat = specific_heat
+  [../]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[BCs]
+  [./ramp]
+    type = FunctionPresetBC
+    variable = temperature
+    boundary = 'left right'
+    function = '300 + 2e4 * x + 2e3 * y + 500 * t'
+  [../]
+[]
+
+[Materials]
+  [./steatite]
+    type = Steatite
+    temperature = temperature
+  [../]
+  [./local_time_step]
+    type = LocalTimeStepMaterial
+    cfl = 20.
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 0.1
+  num_steps = 1
+[]
@@ -0,0 +1,94 @@
+# Refines around a steep front while leaving the elements on and next to the
+# interface between the two blocks alone.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 12
+  ny = 12
+  block_id = '0 1'
+  block_name = 'left right'
+[]
+
+[MeshModifiers]
+  [./right]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.5 0 0'
+    top_right = '1 1 0'
+  [../]
+  [./interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = right
+    master_block = left
+    paired_block = right
+    new_boundary = interface
+  [../]
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[ICs]
+  [./u]
+    type = FunctionIC
+    variable = u
+    function = 'tanh(20 * (x + y - 1))'
+  [../]
+[]
+
+[Kernels]
+  [./diffusion]
+    type = Diffusion
+    variable = u
+  [../]
+  [./time]
+    type = TimeDerivative
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 1e-3
+  num_steps = 2
+[]
+
+[Adaptivity]
+  marker = combo
+  max_h_level = 2
+  [./Indicators]
+    [./jump]
+      type = VarRestrictedGradientJumpIndicator
+      variable = u
+    [../]
+  [../]
+  [./Markers]
+    [./interface_only]
+      type = InterfaceErrorFractionMarker
+      indicator = jump
+      boundary = interface
+      refine = 0.3
+      coarsen = 0.
+    [../]
+    [./with_buffer]
+      type = InterfaceErrorFractionMarker
+      indicator = jump
+      boundary = interface
+      buffer_layers = 1
+      refine = 0.3
+      coarsen = 0.
+    [../]
+    [./combo]
+      type = ComboMarker
+      markers = 'interface_only with_buffer'
+    [../]
+  [../]
+[]
+
+[Outputs]
+  exodus = true
+[]
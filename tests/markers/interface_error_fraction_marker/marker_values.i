@@ -0,0 +1,164 @@
+# Marks a field with kinks along x = 2/12, 5/12 and 7/12, which give the
+# two columns of elements beside each kink (1, 2, 4, 5, 6 and 7) the same
+# gradient jump error and the others none.  Without its band, each marker
+# would refine those six columns.  The interface, at x = 0.5, is on the
+# left-block side of it, so the band of interface_only is column 5 and
+# with_buffer also leaves columns 4 and 6 alone.  The values are sampled
+# along the middle row of elements (ids 76 to 79), with REFINE = 2 and
+# DO_NOTHING = 1, before the mesh is adapted.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 12
+  ny = 12
+  block_id = '0 1'
+  block_name = 'left right'
+[]
+
+[MeshModifiers]
+  [./right]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.5 0 0'
+    top_right = '1 1 0'
+  [../]
+  [./interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = right
+    master_block = left
+    paired_block = right
+    new_boundary = interface
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[ICs]
+  [./u]
+    type = FunctionIC
+    variable = u
+    function = 'abs(x - 0.1666666666666667) + abs(x - 0.4166666666666667) + abs(x - 0.5833333333333333)'
+  [../]
+[]
+
+[Kernels]
+  [./diffusion]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+  num_steps = 1
+[]
+
+[Adaptivity]
+  marker = combo
+  [./Indicators]
+    [./jump]
+      type = VarRestrictedGradientJumpIndicator
+      variable = u
+    [../]
+  [../]
+  [./Markers]
+    [./interface_only]
+      type = InterfaceErrorFractionMarker
+      indicator = jump
+      boundary = interface
+      refine = 0.3
+      coarsen = 0.
+    [../]
+    [./with_buffer]
+      type = InterfaceErrorFractionMarker
+      indicator = jump
+      boundary = interface
+      buffer_layers = 1
+      refine = 0.3
+      coarsen = 0.
+    [../]
+    [./combo]
+      type = ComboMarker
+      markers = 'interface_only with_buffer'
+    [../]
+  [../]
+[]
+
+# The markers are computed at the end of the step, after the postprocessors
+# of timestep_end, so they are sampled at the end of the run.
+[Postprocessors]
+  [./interface_only_4]
+    type = ElementalVariableValue
+    variable = interface_only
+    elementid = 76
+    execute_on = final
+  [../]
+  [./interface_only_5]
+    type = ElementalVariableValue
+    variable = interface_only
+    elementid = 77
+    execute_on = final
+  [../]
+  [./interface_only_6]
+    type = ElementalVariableValue
+    variable = interface_only
+    elementid = 78
+    execute_on = final
+  [../]
+  [./interface_only_7]
+    type = ElementalVariableValue
+    variable = interface_only
+    elementid = 79
+    execute_on = final
+  [../]
+  [./interface_only_total]
+    type = ElementIntegralVariablePostprocessor
+    variable = interface_only
+    execute_on = final
+  [../]
+  [./with_buffer_4]
+    type = ElementalVariableValue
+    variable = with_buffer
+    elementid = 76
+    execute_on = final
+  [../]
+  [./with_buffer_5]
+    type = ElementalVariableValue
+    variable = with_buffer
+    elementid = 77
+    execute_on = final
+  [../]
+  [./with_buffer_6]
+    type = ElementalVariableValue
+    variable = with_buffer
+    elementid = 78
+    execute_on = final
+  [../]
+  [./with_buffer_7]
+    type = ElementalVariableValue
+    variable = with_buffer
+    elementid = 79
+    execute_on = final
+  [../]
+  [./with_buffer_total]
+    type = ElementIntegralVariablePostprocessor
+    variable = with_buffer
+    execute_on = final
+  [../]
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = final
+  [../]
+[]
@@ -0,0 +1,64 @@
+# A plate partly below absolute zero.  The negative temperatures are counted
+# at every qp but reported once per step, by the postprocessor.  Nothing is
+# solved; each step evaluates the material once, in epsilon_integral, at the
+# 4 qps of each of the 8 elements left of x = 0.125: 32 per step.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 8
+  ny = 8
+[]
+
+[Variables]
+  [./temperature]
+  [../]
+[]
+
+[ICs]
+  [./temperature]
+    type = FunctionIC
+    variable = temperature
+    function = '-50 + 400 * x'
+  [../]
+[]
+
+[Kernels]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Materials]
+  [./steatite]
+    type = Steatite
+    temperature = temperature
+  [../]
+[]
+
+[Postprocessors]
+  [./negative_temperatures]
+    type = NegativeTemperatureCount
+    material = steatite
+  [../]
+  [./epsilon_integral]
+    type = ElementIntegralMaterialProperty
+    mat_prop = epsilon
+    outputs = none
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+  num_steps = 2
+[]
+
+[Outputs]
+  csv = true
+[]
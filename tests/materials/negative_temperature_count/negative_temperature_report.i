@@ -0,0 +1,52 @@
+# The plate of negative_temperature_count.i, steady and without a
+# NegativeTemperatureCount: the material's own report of its 32 negative
+# temperatures only comes at the end of the run.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 8
+  ny = 8
+[]
+
+[Variables]
+  [./temperature]
+  [../]
+[]
+
+[ICs]
+  [./temperature]
+    type = FunctionIC
+    variable = temperature
+    function = '-50 + 400 * x'
+  [../]
+[]
+
+[Kernels]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Materials]
+  [./steatite]
+    type = Steatite
+    temperature = temperature
+  [../]
+[]
+
+[Postprocessors]
+  [./epsilon_integral]
+    type = ElementIntegralMaterialProperty
+    mat_prop = epsilon
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+[]
@@ -0,0 +1,88 @@
+# Counts the property cache hits of a plate whose left half keeps its
+# temperature while the right half heats up by 100 K per step.  Nothing is
+# solved, so the materials are only evaluated by the conductivity integral,
+# once per element at the end of each step:
+#
+#   step 1: all 16 elements miss (4 qp each)          hits  0, misses  64
+#   step 2: the 8 left elements hit, the 8 right miss  hits 32, misses  96
+#   step 3: as step 2                                  hits 64, misses 128
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./temperature]
+  [../]
+[]
+
+[Functions]
+  [./heating]
+    type = ParsedFunction
+    value = '300 + if(x > 0.5, 100 * t, 0)'
+  [../]
+[]
+
+[Kernels]
+  [./diffusion]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./temperature]
+    type = FunctionAux
+    variable = temperature
+    function = heating
+    execute_on = 'initial timestep_begin'
+  [../]
+[]
+
+[Materials]
+  [./aluminum]
+    type = Aluminum2024
+    temperature = temperature
+    use_property_cache = true
+  [../]
+[]
+
+[Postprocessors]
+  [./conductivity]
+    type = ElementIntegralMaterialProperty
+    mat_prop = thermal_conductivity
+    outputs = none
+  [../]
+  [./hits]
+    type = ThermalMaterialCacheStatistic
+    material = aluminum
+    statistic = hits
+  [../]
+  [./misses]
+    type = ThermalMaterialCacheStatistic
+    material = aluminum
+    statistic = misses
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+  num_steps = 3
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,80 @@
+# An aluminum plate heated from one edge, whose conductivity, specific heat
+# and density all depend on temperature.  Reusing the cached properties
+# within cache_tolerance must not change the solution beyond that tolerance.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 4
+  xmax = 0.1
+  ymax = 0.04
+[]
+
+[Variables]
+  [./temperature]
+    initial_condition = 300.
+  [../]
+[]
+
+[Kernels]
+  [./thermal_time]
+    type = SpecificHeatConductionTimeDerivative
+    variable = temperature
+  [../]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[BCs]
+  [./cold]
+    type = DirichletBC
+    variable = temperature
+    boundary = left
+    value = 300.
+  [../]
+  [./hot]
+    type = DirichletBC
+    variable = temperature
+    boundary = right
+    value = 650.
+  [../]
+[]
+
+[Materials]
+  [./aluminum]
+    type = Aluminum2024
+    temperature = temperature
+    use_property_cache = true
+  [../]
+[]
+
+[Postprocessors]
+  [./average_temperature]
+    type = ElementAverageValue
+    variable = temperature
+  [../]
+  [./mid_temperature]
+    type = PointValue
+    variable = temperature
+    point = '0.05 0.02 0'
+  [../]
+  [./conductivity]
+    type = ElementIntegralMaterialProperty
+    mat_prop = thermal_conductivity
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 2.
+  num_steps = 4
+  nl_rel_tol = 1e-10
+[]
+
+[Outputs]
+  csv = true
+[]
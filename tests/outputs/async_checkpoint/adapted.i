@@ -0,0 +1,82 @@
+# The radiating plate of async_checkpoint.i, refined every step.  Its
+# checkpoints hold the solution of the refined mesh, so a run starting again
+# from the unrefined one must refuse to resume from them.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 8
+  ny = 8
+[]
+
+[Variables]
+  [./temperature]
+  [../]
+[]
+
+[ICs]
+  [./temperature]
+    type = FunctionIC
+    variable = temperature
+    function = '300 + 200 * x + 20 * y'
+  [../]
+[]
+
+[Kernels]
+  [./thermal_time]
+    type = SpecificHeatConductionTimeDerivative
+    variable = temperature
+  [../]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[BCs]
+  [./radiation]
+    type = RadiationBC
+    variable = temperature
+    boundary = 'left right'
+  [../]
+[]
+
+[Materials]
+  [./aluminum]
+    type = Aluminum2024
+    temperature = temperature
+  [../]
+[]
+
+[Postprocessors]
+  [./average_temperature]
+    type = ElementAverageValue
+    variable = temperature
+  [../]
+[]
+
+[Adaptivity]
+  marker = refine
+  max_h_level = 2
+  [./Markers]
+    [./refine]
+      type = UniformMarker
+      mark = REFINE
+    [../]
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 10
+  num_steps = 2
+  nl_rel_tol = 1e-12
+[]
+
+[Outputs]
+  [./checkpoint]
+    type = AsyncCheckpoint
+    num_files = 2
+  [../]
+[]
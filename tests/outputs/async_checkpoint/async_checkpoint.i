@@ -0,0 +1,75 @@
+# A radiating plate checkpointed every step.  A run stopped after two steps
+# and resumed from its checkpoint must end exactly where the uninterrupted
+# run does.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 8
+  ny = 8
+[]
+
+[Variables]
+  [./temperature]
+  [../]
+[]
+
+[ICs]
+  [./temperature]
+    type = FunctionIC
+    variable = temperature
+    function = '300 + 200 * x + 20 * y'
+  [../]
+[]
+
+[Kernels]
+  [./thermal_time]
+    type = SpecificHeatConductionTimeDerivative
+    variable = temperature
+  [../]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[BCs]
+  [./radiation]
+    type = RadiationBC
+    variable = temperature
+    boundary = 'left right'
+  [../]
+[]
+
+[Materials]
+  [./aluminum]
+    type = Aluminum2024
+    temperature = temperature
+  [../]
+[]
+
+[Postprocessors]
+  [./average_temperature]
+    type = ElementAverageValue
+    variable = temperature
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  dt = 10
+  num_steps = 4
+  nl_rel_tol = 1e-12
+[]
+
+[Outputs]
+  [./exodus]
+    type = Exodus
+    execute_on = final
+  [../]
+  [./checkpoint]
+    type = AsyncCheckpoint
+    num_files = 2
+  [../]
+[]
@@ -0,0 +1,111 @@
+# Counts the calls of a material and an aux kernel.  Nothing is solved, so
+# they are only called at the end of each step, a known number of times:
+# the material once per element (16) for the conductivity integral, and the
+# wall heat flux once per side of the right boundary (4), where it also
+# evaluates the face copy of the material (aluminum_face) for the
+# conductivity.  The times differ from run to run, so they are not output
+# here and not compared in the timing table.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 4
+  ny = 4
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[AuxVariables]
+  [./temperature]
+    initial_condition = 400.
+  [../]
+  [./rho]
+    initial_condition = 1.2
+  [../]
+  [./rhoE]
+    initial_condition = 3.4e5
+  [../]
+  [./wall_heat_flux]
+    family = MONOMIAL
+    order = CONSTANT
+  [../]
+[]
+
+[Kernels]
+  [./diffusion]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxKernels]
+  [./wall_heat_flux]
+    type = NSWallHeatFluxAux
+    variable = wall_heat_flux
+    boundary = right
+    rho = rho
+    rhoE = rhoE
+    fluid_properties = ideal_gas
+    execute_on = timestep_end
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./ideal_gas]
+      type = IdealGasFluidProperties
+      gamma = 1.4
+      R = 287
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./aluminum]
+    type = Aluminum2024
+    temperature = temperature
+  [../]
+[]
+
+[Postprocessors]
+  [./conductivity]
+    type = ElementIntegralMaterialProperty
+    mat_prop = thermal_conductivity
+    outputs = none
+  [../]
+  [./material_calls]
+    type = ObjectWallTime
+    object = aluminum
+    statistic = calls
+  [../]
+  [./material_time]
+    type = ObjectWallTime
+    object = aluminum
+    outputs = none
+  [../]
+  [./wall_heat_flux_calls]
+    type = ObjectWallTime
+    object = wall_heat_flux
+    statistic = calls
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+  num_steps = 2
+[]
+
+[Outputs]
+  csv = true
+  [./timing]
+    type = ObjectTimingTable
+  [../]
+[]
@@ -0,0 +1,71 @@
+# Runs object_calls.i as a MultiApp under a master with a material of the
+# same name.  Each app counts only the calls of its own objects: the master
+# material once per element (4), the sub app's as in object_calls.i.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 2
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diffusion]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[AuxVariables]
+  [./temperature]
+    initial_condition = 400.
+  [../]
+[]
+
+[Materials]
+  [./aluminum]
+    type = Aluminum2024
+    temperature = temperature
+  [../]
+[]
+
+[Postprocessors]
+  [./conductivity]
+    type = ElementIntegralMaterialProperty
+    mat_prop = thermal_conductivity
+    outputs = none
+  [../]
+  [./material_calls]
+    type = ObjectWallTime
+    object = aluminum
+    statistic = calls
+  [../]
+[]
+
+[MultiApps]
+  [./sub]
+    type = TransientMultiApp
+    input_files = object_calls.i
+    positions = '0 0 0'
+    execute_on = timestep_end
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  dt = 1
+  num_steps = 2
+[]
+
+[Outputs]
+  csv = true
+[]
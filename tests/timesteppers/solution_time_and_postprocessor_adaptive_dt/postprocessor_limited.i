@@ -0,0 +1,80 @@
+# The time stepper watching a postprocessor that follows 1000 t^2, with
+# nothing solved.  percent_change = 0 holds the solve-time dt at the last
+# dt, so dt depends only on the postprocessor and is the same on every
+# machine: it doubles while the change stays below half the threshold, the
+# step from t = 0.031 with dt = 0.016 overshoots (1.248) and is retried with
+# dt = 0.008, and dt then aims for 80% of the threshold.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1
+[]
+
+[Problem]
+  solve = false
+[]
+
+[Variables]
+  [./u]
+  [../]
+[]
+
+[Kernels]
+  [./diffusion]
+    type = Diffusion
+    variable = u
+  [../]
+[]
+
+[Functions]
+  [./watched]
+    type = ParsedFunction
+    value = '1000 * t * t'
+  [../]
+[]
+
+[Postprocessors]
+  [./watched]
+    type = FunctionValuePostprocessor
+    function = watched
+    execute_on = 'initial timestep_end custom'
+  [../]
+  [./dt]
+    type = TimestepSize
+  [../]
+  [./accepted_steps]
+    type = AdaptiveDTStatistic
+    statistic = accepted_steps
+  [../]
+  [./postprocessor_rejections]
+    type = AdaptiveDTStatistic
+    statistic = postprocessor_rejections
+  [../]
+  [./rejection_fraction]
+    type = AdaptiveDTStatistic
+  [../]
+  [./change_ratio]
+    type = AdaptiveDTStatistic
+    statistic = change_ratio
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  num_steps = 12
+  [./TimeStepper]
+    type = SolutionTimeAndPostProcessorAdaptiveDT
+    dt = 1e-3
+    percent_change = 0
+    postprocessor = watched
+    threshold = 1.
+  [../]
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = timestep_end
+  [../]
+[]
@@ -0,0 +1,76 @@
+# A steatite plate heated on its left edge.  The time stepper watches the
+# average temperature of the heated edge.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 10
+  ny = 2
+  xmax = 0.01
+  ymax = 0.002
+[]
+
+[Variables]
+  [./temperature]
+    initial_condition = 300.
+  [../]
+[]
+
+[Kernels]
+  [./thermal_time]
+    type = SpecificHeatConductionTimeDerivative
+    variable = temperature
+  [../]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[BCs]
+  [./heating]
+    type = NeumannBC
+    variable = temperature
+    boundary = left
+    value = 1e5
+  [../]
+[]
+
+[Materials]
+  [./steatite]
+    type = Steatite
+    temperature = temperature
+  [../]
+[]
+
+[Postprocessors]
+  [./edge_temperature]
+    type = SideAverageValue
+    variable = temperature
+    boundary = left
+    execute_on = 'initial timestep_end custom'
+  [../]
+  [./rejection_fraction]
+    type = AdaptiveDTStatistic
+  [../]
+  [./postprocessor_rejections]
+    type = AdaptiveDTStatistic
+    statistic = postprocessor_rejections
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  num_steps = 12
+  [./TimeStepper]
+    type = SolutionTimeAndPostProcessorAdaptiveDT
+    dt = 1e-3
+    postprocessor = edge_temperature
+    threshold = 1.
+  [../]
+[]
+
+[Outputs]
+  csv = true
+[]
@@ -0,0 +1,146 @@
+# Two plates 1 m wide facing each other across a 0.1 mm gap, held at 700 K
+# and 400 K.  Their emissivities rise with temperature (emissivity.csv), to
+# 0.7 and 0.4 at the faces.  The gap is narrow enough for the plates to be
+# infinite to within 3e-4, where the net flux between them is
+#   q = sigma (T1^4 - T2^4) / (1/eps1 + 1/eps2 - 1) = 4153.198 W/m^2.
+#
+# Every node is held, so the solve only evaluates the residual: RadiationBC
+# saves its integral over each facing surface, the net power per unit depth,
+# in radiated.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 3
+  xmax = 1
+  ymax = 3e-4
+[]
+
+[MeshModifiers]
+  [./gap]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0 1e-4 0'
+    top_right = '1 2e-4 0'
+  [../]
+  [./upper]
+    type = SubdomainBoundingBox
+    block_id = 2
+    bottom_left = '0 2e-4 0'
+    top_right = '1 3e-4 0'
+  [../]
+  [./hot_facing]
+    type = SideSetsBetweenSubdomains
+    depends_on = 'gap upper'
+    master_block = 0
+    paired_block = 1
+    new_boundary = hot_facing
+  [../]
+  [./cold_facing]
+    type = SideSetsBetweenSubdomains
+    depends_on = 'gap upper'
+    master_block = 2
+    paired_block = 1
+    new_boundary = cold_facing
+  [../]
+[]
+
+[Variables]
+  [./temperature]
+    block = '0 2'
+  [../]
+[]
+
+[AuxVariables]
+  [./radiated]
+    block = '0 2'
+  [../]
+[]
+
+[ICs]
+  [./hot]
+    type = ConstantIC
+    variable = temperature
+    block = 0
+    value = 700.
+  [../]
+  [./cold]
+    type = ConstantIC
+    variable = temperature
+    block = 2
+    value = 400.
+  [../]
+[]
+
+[Kernels]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[BCs]
+  [./hot]
+    type = DirichletBC
+    variable = temperature
+    boundary = 'bottom hot_facing'
+    value = 700.
+  [../]
+  [./cold]
+    type = DirichletBC
+    variable = temperature
+    boundary = 'top cold_facing'
+    value = 400.
+  [../]
+  [./radiation]
+    type = RadiationBC
+    variable = temperature
+    boundary = 'hot_facing cold_facing'
+    radiation_exchange = exchange
+    save_in = radiated
+  [../]
+[]
+
+[UserObjects]
+  [./exchange]
+    type = SurfaceRadiationExchange
+    boundary = 'hot_facing cold_facing'
+    variable = temperature
+    execute_on = initial
+  [../]
+[]
+
+[Materials]
+  [./material]
+    type = TabulatedThermalMaterial
+    block = '0 2'
+    temperature = temperature
+    property_file = emissivity.csv
+  [../]
+[]
+
+[Postprocessors]
+  [./hot_net_flux]
+    type = NodalSum
+    variable = radiated
+    boundary = hot_facing
+  [../]
+  [./cold_net_flux]
+    type = NodalSum
+    variable = radiated
+    boundary = cold_facing
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
+
+[Outputs]
+  [./csv]
+    type = CSV
+    execute_on = timestep_end
+  [../]
+[]
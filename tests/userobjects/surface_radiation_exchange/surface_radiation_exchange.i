@@ -0,0 +1,114 @@
+# Two steatite plates facing each other across an empty gap, the lower one
+# held hot and the upper one cold.  The facing surfaces exchange radiation
+# with each other and lose the rest through the open ends of the gap.  The
+# radiated flux, which follows from the irradiation of each face, is saved
+# in radiated and summed over the facing boundary.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 20
+  ny = 12
+  xmax = 0.1
+  ymax = 0.012
+[]
+
+[MeshModifiers]
+  [./gap]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0 0.002 0'
+    top_right = '0.1 0.010 0'
+  [../]
+  [./facing]
+    type = SideSetsBetweenSubdomains
+    depends_on = gap
+    master_block = 0
+    paired_block = 1
+    new_boundary = facing
+  [../]
+[]
+
+[Variables]
+  [./temperature]
+    block = 0
+    initial_condition = 600.
+  [../]
+[]
+
+[AuxVariables]
+  [./radiated]
+    block = 0
+  [../]
+[]
+
+[Kernels]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[BCs]
+  [./hot]
+    type = DirichletBC
+    variable = temperature
+    boundary = bottom
+    value = 1000.
+  [../]
+  [./cold]
+    type = DirichletBC
+    variable = temperature
+    boundary = top
+    value = 300.
+  [../]
+  [./radiation]
+    type = RadiationBC
+    variable = temperature
+    boundary = facing
+    radiation_exchange = exchange
+    save_in = radiated
+  [../]
+[]
+
+[UserObjects]
+  [./exchange]
+    type = SurfaceRadiationExchange
+    boundary = facing
+    variable = temperature
+    ambient_temp = 300.
+    view_factor_file = view_factors.bin
+    execute_on = 'initial linear'
+  [../]
+[]
+
+[Materials]
+  [./steatite]
+    type = Steatite
+    block = 0
+    temperature = temperature
+  [../]
+[]
+
+[Postprocessors]
+  [./facing_temperature]
+    type = SideAverageValue
+    variable = temperature
+    boundary = facing
+  [../]
+  [./radiated_flux]
+    type = NodalSum
+    variable = radiated
+    boundary = facing
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = PJFNK
+  nl_rel_tol = 1e-8
+[]
+
+[Outputs]
+  csv = true
+[]
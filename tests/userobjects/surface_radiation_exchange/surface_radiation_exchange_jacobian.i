@@ -0,0 +1,87 @@
+# Checks the RadiationBC Jacobian with the irradiation taken from a
+# SurfaceRadiationExchange, which is held fixed over the solve.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 3
+  ny = 5
+  xmax = 0.01
+  ymax = 0.005
+[]
+
+[MeshModifiers]
+  [./gap]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0 0.001 0'
+    top_right = '0.01 0.004 0'
+  [../]
+  [./facing]
+    type = SideSetsBetweenSubdomains
+    depends_on = gap
+    master_block = 0
+    paired_block = 1
+    new_boundary = facing
+  [../]
+[]
+
+[Variables]
+  [./temperature]
+    block = 0
+  [../]
+[]
+
+[ICs]
+  [./temperature]
+    type = FunctionIC
+    variable = temperature
+    function = '500 + 2e4 * x + 1e5 * y'
+  [../]
+[]
+
+[Kernels]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[BCs]
+  [./radiation]
+    type = RadiationBC
+    variable = temperature
+    boundary = facing
+    radiation_exchange = exchange
+  [../]
+[]
+
+[UserObjects]
+  [./exchange]
+    type = SurfaceRadiationExchange
+    boundary = facing
+    variable = temperature
+    execute_on = initial
+  [../]
+[]
+
+[Materials]
+  [./material]
+    type = TabulatedThermalMaterial
+    block = 0
+    temperature = temperature
+    property_file = emissivity.csv
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
@@ -0,0 +1,207 @@
+# The NSThermalFluxInterface problem of tests/interfacekernels on one fluid
+# and one solid element, with its flux terms sampled every other step and
+# streamed to a single file.  Every node is held at the linear initial state,
+# so the samples are known in closed form on the interface x = 0.5:
+#   fluid_temperature  400 + 10 y
+#   solid_temperature  450 - 20 y
+#   fluid_conduction   -2.57e-2 * 200 = -5.14
+#   solid_conduction   0
+#   fluid_external     -1e3 y
+#   solid_external     500
+#   radiation          0.35 sigma ((450 - 20 y)^4 - 350^4)
+
+[GlobalParams]
+  family = LAGRANGE
+  order = FIRST
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 2
+  ny = 1
+  block_id = '0 1'
+  block_name = 'fluid solid'
+[]
+
+[MeshModifiers]
+  [./solid]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.5 0 0'
+    top_right = '1 1 0'
+  [../]
+  [./interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = solid
+    master_block = fluid
+    paired_block = solid
+    new_boundary = interface
+  [../]
+  [./solid_interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = solid
+    master_block = solid
+    paired_block = fluid
+    new_boundary = solid_interface
+  [../]
+[]
+
+[Variables]
+  [./rho]
+    block = fluid
+    initial_condition = 1.2
+  [../]
+  [./rhoE]
+    block = fluid
+  [../]
+  [./solid_temperature]
+    block = solid
+  [../]
+[]
+
+[ICs]
+  [./rhoE]
+    type = FunctionIC
+    variable = rhoE
+    function = rhoE
+  [../]
+  [./solid_temperature]
+    type = FunctionIC
+    variable = solid_temperature
+    function = solid_temperature
+  [../]
+[]
+
+[BCs]
+  [./rhoE]
+    type = FunctionPresetBC
+    variable = rhoE
+    boundary = 'left interface'
+    function = rhoE
+  [../]
+  [./solid_temperature]
+    type = FunctionPresetBC
+    variable = solid_temperature
+    boundary = 'solid_interface right'
+    function = solid_temperature
+  [../]
+[]
+
+[Functions]
+  [./rhoE]
+    type = ParsedFunction
+    value = '1.2 * 717.5 * (300 + 200 * x + 10 * y)'
+  [../]
+  [./solid_temperature]
+    type = ParsedFunction
+    value = '450 - 20 * y'
+  [../]
+  [./fluid_flux]
+    type = ParsedVectorFunction
+    value_x = 1e3*y
+    value_y = 0
+  [../]
+  [./solid_flux]
+    type = ParsedVectorFunction
+    value_x = -5e2
+    value_y = 2e2*x
+  [../]
+[]
+
+[Kernels]
+  [./rho_time]
+    type = TimeDerivative
+    variable = rho
+  [../]
+  [./rho_space]
+    type = Diffusion
+    variable = rho
+  [../]
+  [./rhoE_time]
+    type = TimeDerivative
+    variable = rhoE
+  [../]
+  [./rhoE_space]
+    type = Diffusion
+    variable = rhoE
+  [../]
+  [./thermal_time]
+    type = SpecificHeatConductionTimeDerivative
+    variable = solid_temperature
+  [../]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = solid_temperature
+  [../]
+[]
+
+[InterfaceKernels]
+  [./interface_flux]
+    type = NSThermalFluxInterface
+    variable = rhoE
+    neighbor_var = solid_temperature
+    boundary = interface
+    rho = rho
+    fluid_properties = ideal_gas
+    var_heat_flux_func = fluid_flux
+    neighbor_heat_flux_func = solid_flux
+    radiation_temp = 350
+    heat_flux_sampler = samples
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./ideal_gas]
+      type = IdealGasFluidProperties
+      gamma = 1.4
+      R = 287
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./fluid]
+    type = GenericConstantMaterial
+    block = fluid
+    prop_names = 'thermal_conductivity epsilon'
+    prop_values = '2.57e-2 0.'
+  [../]
+  [./solid]
+    type = Aluminum2024
+    block = solid
+    temperature = solid_temperature
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Transient
+  solve_type = NEWTON
+  num_steps = 4
+  dt = 1e-2
+  nl_rel_tol = 1e-10
+[]
+
+[VectorPostprocessors]
+  [./samples]
+    type = InterfaceHeatFluxSampler
+    stride = 2
+    outputs = none
+  [../]
+[]
+
+[Outputs]
+  [./interface_flux]
+    type = InterfaceHeatFluxStream
+    sampler = samples
+    format = csv
+  [../]
+[]
@@ -0,0 +1,133 @@
+# Synthetic elements for timing the residuals and Jacobians of
+# HeatConductionDMI, RadiationBC and NSThermalFluxInterface in
+# KernelBenchmarkTest: a fluid block (x < 0.5) and an Aluminum2024 block
+# (x > 0.5) sharing an interface, with the solid radiating from its right side.
+# The fluid equations are plain diffusion.
+
+[GlobalParams]
+  family = LAGRANGE
+  order = FIRST
+[]
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 2
+  nx = 64
+  ny = 64
+  block_id = '0 1'
+  block_name = 'fluid solid'
+[]
+
+[MeshModifiers]
+  [./solid]
+    type = SubdomainBoundingBox
+    block_id = 1
+    bottom_left = '0.5 0 0'
+    top_right = '1 1 0'
+  [../]
+  [./interface]
+    type = SideSetsBetweenSubdomains
+    depends_on = solid
+    master_block = fluid
+    paired_block = solid
+    new_boundary = interface
+  [../]
+[]
+
+[Variables]
+  [./rho]
+    block = fluid
+    initial_condition = 1.2
+  [../]
+  [./rhoE]
+    block = fluid
+  [../]
+  [./solid_temperature]
+    block = solid
+  [../]
+[]
+
+[ICs]
+  [./rhoE]
+    type = FunctionIC
+    variable = rhoE
+    function = '1.2 * 717.5 * (300 + 200 * x + 10 * y)'
+  [../]
+  [./solid_temperature]
+    type = FunctionIC
+    variable = solid_temperature
+    function = '450 - 20 * y'
+  [../]
+[]
+
+[Kernels]
+  [./rho_space]
+    type = Diffusion
+    variable = rho
+  [../]
+  [./rhoE_space]
+    type = Diffusion
+    variable = rhoE
+  [../]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = solid_temperature
+  [../]
+[]
+
+[BCs]
+  [./radiation]
+    type = RadiationBC
+    variable = solid_temperature
+    boundary = right
+    ambient_temp = 250.
+  [../]
+[]
+
+[InterfaceKernels]
+  [./interface_flux]
+    type = NSThermalFluxInterface
+    variable = rhoE
+    neighbor_var = solid_temperature
+    boundary = interface
+    rho = rho
+    fluid_properties = ideal_gas
+    radiation_temp = 350
+  [../]
+[]
+
+[Modules]
+  [./FluidProperties]
+    [./ideal_gas]
+      type = IdealGasFluidProperties
+      gamma = 1.4
+      R = 287
+    [../]
+  [../]
+[]
+
+[Materials]
+  [./fluid]
+    type = GenericConstantMaterial
+    block = fluid
+    prop_names = 'thermal_conductivity epsilon'
+    prop_values = '2.57e-2 0.'
+  [../]
+  [./solid]
+    type = Aluminum2024
+    block = solid
+    temperature = solid_temperature
+  [../]
+[]
+
+[Preconditioning]
+  [./SMP]
+    type = SMP
+    full = true
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
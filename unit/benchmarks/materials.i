@@ -0,0 +1,43 @@
+# A dense temperature sweep for timing one ThermalMaterial: 1000 elements of
+# two quadrature points each spanning 1 K to 3000 K.  MaterialBenchmarkTest
+# sets the material type and batch_evaluation on the command line.
+
+[Mesh]
+  type = GeneratedMesh
+  dim = 1
+  nx = 1000
+  xmin = 1
+  xmax = 3000
+[]
+
+[Variables]
+  [./temperature]
+  [../]
+[]
+
+[ICs]
+  [./temperature]
+    type = FunctionIC
+    variable = temperature
+    function = 'x'
+  [../]
+[]
+
+[Kernels]
+  [./thermal_space]
+    type = HeatConductionDMI
+    variable = temperature
+  [../]
+[]
+
+[Materials]
+  [./material]
+    type = Aluminum2024
+    temperature = temperature
+  [../]
+[]
+
+[Executioner]
+  type = Steady
+  solve_type = NEWTON
+[]
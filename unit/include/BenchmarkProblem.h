@@ -0,0 +1,63 @@
+#ifndef BENCHMARKPROBLEM_H
+#define BENCHMARKPROBLEM_H
+
+#include "MooseTypes.h"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+class FEProblemBase;
+class MooseApp;
+
+/**
+ * A Phoenix app built from one of the decks in unit/benchmarks, for timing
+ * its objects outside of a solve.
+ *
+ * The residual or Jacobian is evaluated at the initial condition, and the
+ * time of each object is read from its PhaseTimer counters, so it covers
+ * only that object's own work and none of the assembly around it.
+ */
+class BenchmarkProblem
+{
+public:
+  /**
+   * @param deck file name within unit/benchmarks
+   * @param cli_args command line overrides of the deck
+   */
+  BenchmarkProblem(const std::string & deck, const std::vector<std::string> & cli_args = {});
+
+  /// Nanoseconds per call of the object called name while evaluating the residual.
+  Real residualTime(const std::string & name);
+
+  /// Nanoseconds per call of the object called name while evaluating the Jacobian.
+  Real jacobianTime(const std::string & name);
+
+  /**
+   * Append one result to benchmark_results.csv in the working directory,
+   * which is started afresh by the first result of a run.  kind is "time"
+   * for timings and "error" for accuracy measures; both are better lower.
+   * scripts/check_benchmarks.py compares the file against a baseline.
+   */
+  static void record(const std::string & suite,
+                     const std::string & name,
+                     const std::string & metric,
+                     const std::string & kind,
+                     Real value);
+
+protected:
+  /**
+   * The fastest per-call time of the object called name over a few batches
+   * of evaluate(), which is less noisy than the mean.
+   */
+  Real timePerCall(const std::string & name, const std::function<void()> & evaluate);
+
+  /// Storage for the arguments the app was built from.
+  std::vector<std::string> _args;
+
+  std::shared_ptr<MooseApp> _app;
+  FEProblemBase * _problem;
+};
+
+#endif // BENCHMARKPROBLEM_H
@@ -0,0 +1,40 @@
+#ifndef KERNELBENCHMARKTEST_H
+#define KERNELBENCHMARKTEST_H
+
+// CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * Times the residual and Jacobian of HeatConductionDMI, RadiationBC and
+ * NSThermalFluxInterface on the synthetic elements of
+ * unit/benchmarks/conjugate.i, and records the nanoseconds per element or
+ * side in benchmark_results.csv.
+ */
+class KernelBenchmarkTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE(KernelBenchmarkTest);
+
+  CPPUNIT_TEST(heatConductionDMI);
+  CPPUNIT_TEST(radiationBC);
+  CPPUNIT_TEST(nsThermalFluxInterface);
+  CPPUNIT_TEST(nsThermalFluxInterfacePerQp);
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void heatConductionDMI();
+  void radiationBC();
+  void nsThermalFluxInterface();
+  void nsThermalFluxInterfacePerQp();
+
+private:
+  /// Time the object called name in conjugate.i and record it as type.
+  void benchmark(const std::string & name,
+                 const std::string & type,
+                 const std::vector<std::string> & cli_args = {});
+};
+
+#endif // KERNELBENCHMARKTEST_H
@@ -0,0 +1,36 @@
+#ifndef MATERIALBENCHMARKTEST_H
+#define MATERIALBENCHMARKTEST_H
+
+// CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+#include <string>
+
+/**
+ * Times the property evaluation of the Phoenix materials over a dense
+ * temperature sweep (unit/benchmarks/materials.i), both per qp through
+ * computeQpProperties and batched through the fits, and records the
+ * nanoseconds per element in benchmark_results.csv.
+ */
+class MaterialBenchmarkTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE(MaterialBenchmarkTest);
+
+  CPPUNIT_TEST(aluminum2024);
+  CPPUNIT_TEST(aluminum7075);
+  CPPUNIT_TEST(atmosphere);
+  CPPUNIT_TEST(steatite);
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void aluminum2024();
+  void aluminum7075();
+  void atmosphere();
+  void steatite();
+
+private:
+  void benchmark(const std::string & type);
+};
+
+#endif // MATERIALBENCHMARKTEST_H
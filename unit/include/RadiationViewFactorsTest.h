@@ -0,0 +1,29 @@
+#ifndef RADIATIONVIEWFACTORSTEST_H
+#define RADIATIONVIEWFACTORSTEST_H
+
+// CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+/**
+ * Checks the 2D view factors against analytical values, their reciprocity
+ * and closure, and the blocking of rays by other faces.
+ */
+class RadiationViewFactorsTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE(RadiationViewFactorsTest);
+
+  CPPUNIT_TEST(parallelPlates);
+  CPPUNIT_TEST(reciprocity);
+  CPPUNIT_TEST(enclosureClosure);
+  CPPUNIT_TEST(blockedPlates);
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void parallelPlates();
+  void reciprocity();
+  void enclosureClosure();
+  void blockedPlates();
+};
+
+#endif // RADIATIONVIEWFACTORSTEST_H
@@ -0,0 +1,41 @@
+#ifndef THERMALPROPERTYCONSISTENCYTEST_H
+#define THERMALPROPERTYCONSISTENCYTEST_H
+
+// CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+#include "PiecewisePolynomial.h"
+
+#include <string>
+
+/**
+ * Checks that the property fits of the Phoenix materials are continuous at
+ * their breakpoints and that their derivatives agree with finite
+ * differences of their values, and records the worst jump and derivative
+ * error of each fit in benchmark_results.csv.
+ */
+class ThermalPropertyConsistencyTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE(ThermalPropertyConsistencyTest);
+
+  CPPUNIT_TEST(aluminum2024);
+  CPPUNIT_TEST(aluminum7075);
+  CPPUNIT_TEST(atmosphere);
+  CPPUNIT_TEST(steatite);
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void aluminum2024();
+  void aluminum7075();
+  void atmosphere();
+  void steatite();
+
+private:
+  void checkFits(const std::string & material, const ThermalPropertyFits & fits);
+  void checkFit(const std::string & material,
+                const std::string & property,
+                const PiecewisePolynomial & fit);
+};
+
+#endif // THERMALPROPERTYCONSISTENCYTEST_H
@@ -0,0 +1,43 @@
+#ifndef THERMALPROPERTYFITSTEST_H
+#define THERMALPROPERTYFITSTEST_H
+
+// CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+#include "PiecewisePolynomial.h"
+
+#include <functional>
+
+/**
+ * Checks the batched property fits of the Phoenix materials against the
+ * per-qp polynomial fits they replace.
+ */
+class ThermalPropertyFitsTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE(ThermalPropertyFitsTest);
+
+  CPPUNIT_TEST(aluminum2024);
+  CPPUNIT_TEST(aluminum7075);
+  CPPUNIT_TEST(aluminum7075Breakpoints);
+  CPPUNIT_TEST(atmosphere);
+  CPPUNIT_TEST(steatite);
+  CPPUNIT_TEST(batchMatchesPointwise);
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void aluminum2024();
+  void aluminum7075();
+  void aluminum7075Breakpoints();
+  void atmosphere();
+  void steatite();
+  void batchMatchesPointwise();
+
+private:
+  typedef std::function<void(Real, Real &, Real &)> ReferenceFit;
+
+  /// Compare a fit to its reference over a dense temperature sweep.
+  void checkFit(const PiecewisePolynomial & fit, const ReferenceFit & reference);
+};
+
+#endif // THERMALPROPERTYFITSTEST_H
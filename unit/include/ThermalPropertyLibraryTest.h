@@ -0,0 +1,28 @@
+#ifndef THERMALPROPERTYLIBRARYTEST_H
+#define THERMALPROPERTYLIBRARYTEST_H
+
+// CPPUnit includes
+#include "cppunit/extensions/HelperMacros.h"
+
+/**
+ * Checks that property files are parsed into the same fits as the compiled
+ * materials, that tables interpolate correctly, and that the files shipped in
+ * data/materials agree with the compiled materials.
+ */
+class ThermalPropertyLibraryTest : public CppUnit::TestFixture
+{
+  CPPUNIT_TEST_SUITE(ThermalPropertyLibraryTest);
+
+  CPPUNIT_TEST(polynomialFile);
+  CPPUNIT_TEST(pointTable);
+  CPPUNIT_TEST(dataFiles);
+
+  CPPUNIT_TEST_SUITE_END();
+
+public:
+  void polynomialFile();
+  void pointTable();
+  void dataFiles();
+};
+
+#endif // THERMALPROPERTYLIBRARYTEST_H